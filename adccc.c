@@ -11,6 +11,67 @@
 //*****************************************************************************
 
 #include "adccc.h"
+
+//*****************************************************************************
+//                              Variables
+//*****************************************************************************
+#define ADC_MODE_SINGLE     0               // Una conversion, sale de LPM
+#define ADC_MODE_SCAN       1               // Secuencia de canales
+#define ADC_MODE_ASYNC      2               // Una conversion, no bloqueante
+#define ADC_MODE_OVERSAMPLE 3               // Acumula conversiones repetidas
+#define ADC_MODE_PERIODIC   4               // Conversiones disparadas por timer
+#define ADC_MODE_STREAM     5               // Timer hacia buffer circular
+#define ADC_MODE_WINDOW     6               // Comparador de ventana
+
+static volatile uint8_t  adcMode = ADC_MODE_SINGLE;
+static volatile uint8_t  adcChannel;        // Canal en conversion (secuencia)
+static volatile uint16_t adcScanMask;       // Canales a guardar (secuencia)
+static volatile uint8_t  adcIndex;          // Proxima posicion en adcResults
+static uint16_t*         adcResults;        // Destino de las conversiones
+static volatile uint8_t  adcState = ADC_STATE_IDLE;   // Estado de la conversion asincronica
+static volatile uint16_t adcAsyncResult;    // Resultado de la conversion asincronica
+static ADC_callback      adcCallback;       // Se llama desde ADC_ISR al finalizar
+static volatile uint16_t adcSamples;        // Conversiones restantes
+static volatile uint32_t adcAccumulator;    // Suma de conversiones (sobremuestreo)
+static RINGBUF_buffer*   adcRing;           // Destino de la adquisicion continua
+static uint16_t          adcWakeLevel;      // Muestras para despertar a la CPU
+static volatile uint8_t  adcWindowEvent;    // Limite superado (comparador de ventana)
+static volatile uint8_t  adcDone;           // ADC_ISR termino la espera
+
+static uint16_t vrefCache;                  // Ultima conversion de la referencia
+static uint16_t vrefAge;                    // Llamadas desde la ultima medicion
+static uint16_t vrefMaxAge = ADC_VREF_MAX_AGE;
+static uint8_t  vrefValid;                  // vrefCache puede utilizarse
+static uint16_t vrefWitness;                // Base de ADC_checkVrefDrift()
+static uint8_t  vrefWitnessValid;
+
+static uint16_t settleEpsilon = ADC_SETTLE_EPSILON;
+
+// Tiempos de estabilizacion aprendidos en us, 0: sin aprender. Persisten en FRAM.
+#if defined(__TI_COMPILER_VERSION__)
+#pragma PERSISTENT(settleLearned)
+static uint16_t settleLearned[ADC_CHANNELS] = {0};
+#elif defined(__IAR_SYSTEMS_ICC__)
+__persistent static uint16_t settleLearned[ADC_CHANNELS] = {0};
+#elif defined(__GNUC__) && defined(__MSP430__)
+static uint16_t settleLearned[ADC_CHANNELS] __attribute__((persistent)) = {0};
+#else
+static uint16_t settleLearned[ADC_CHANNELS];
+#endif
+
+#ifdef ADC_PROFILE
+static ADC_profile adcProfiles[ADC_PROFILE_SENSORS];
+static uint8_t     adcProfileCount;
+static uint16_t    adcProfileCycles;        // TA1R de la marca anterior
+static uint32_t    adcProfileTicks;         // TIMER_getTime() al comenzar la estabilizacion
+
+#define ADC_PROFILE_BEGIN()                 ADC_profileBegin()
+#define ADC_PROFILE_PHASE(adcPin, phase)    ADC_profilePhase(adcPin, phase)
+#else
+#define ADC_PROFILE_BEGIN()
+#define ADC_PROFILE_PHASE(adcPin, phase)
+#endif
+
 //*****************************************************************************
 static inline void ADC_initPin(const uint16_t adcInput)
 {
@@ -29,10 +90,22 @@ static void ADC_initPort(const uint8_t adcInput)
     ADCIE = ADCIE0;                         // Enable ADC conv complete interrupt
 }
 //*****************************************************************************
+static void ADC_sleep(void)
+{
+    // Otra interrupcion puede despertar a la CPU antes que ADC_ISR
+    __disable_interrupt();
+    while(!adcDone)
+    {
+        __bis_SR_register(ADC_LPM_BITS | GIE);  // ADC_ISR will force exit
+        __disable_interrupt();
+    }
+}
+//*****************************************************************************
 static inline void ADC_start(void)
 {
+    adcDone = 0;
     ADCCTL0 |= ADCENC | ADCSC;              // Sampling and conversion start
-    __bis_SR_register(LPM3_bits | GIE);     // Enter LPM0, ADC_ISR will force exit
+    ADC_sleep();
 }
 //*****************************************************************************
 static void ADC_initVref(void)
@@ -40,8 +113,7 @@ static void ADC_initVref(void)
     // Configure reference module located in the PMM
     PMMCTL0_H = PMMPW_H;                    // Unlock the PMM registers
     PMMCTL2 |= INTREFEN;                    // Enable internal reference
-    delay_us(60);                           // Poll till internal reference settles
-    //while(!(PMMCTL2 & REFGENRDY));        // Poll till internal reference settles
+    while(!(PMMCTL2 & REFGENRDY));          // Poll till internal reference settles
 }
 //*****************************************************************************
 static inline void ADC_stopVref(void)
@@ -55,55 +127,514 @@ static inline void ADC_stop(void)
     ADCCTL0 &= ~(ADCENC | ADCON);
 }
 //*****************************************************************************
+static void ADC_initTrigger(const uint16_t period)
+{
+    TA1CTL = TACLR;
+    TA1CCR0 = period - 1;                   // Sampling period
+    TA1CCR1 = period >> 1;                  // TA1.1 rising edge every period
+    TA1CCTL1 = OUTMOD_7;                    // Reset/set
+    TA1CTL = TASSEL_1 + MC_1;               // ACLK, up mode
+}
+//*****************************************************************************
+static inline void ADC_stopTrigger(void)
+{
+    TA1CTL = MC_0;
+}
+//*****************************************************************************
+static uint16_t ADC_convert(const uint8_t adcPin)
+{
+    // Inicializa Pin ADC
+    ADC_initPin(0x0001 << adcPin);
+
+    // Configura el ADC
+    ADC_initPort(adcPin);
+
+    // Inicia la conversion
+    ADC_start();
+
+    // Detiene el ADC
+    ADC_stop();
+
+    return(ADCMEM0);
+}
+//*****************************************************************************
+static void ADC_storeSettle(const uint8_t adcPin, const uint16_t settleUs)
+{
+    uint16_t protect = SYSCFG0 & (PFWP | DFWP);
+
+    SYSCFG0 = FRWPPW | (protect & ~PFWP);   // Program FRAM write enable
+    settleLearned[adcPin] = settleUs;
+    SYSCFG0 = FRWPPW | protect;             // Restore write protection
+}
+#ifdef ADC_PROFILE
+//*****************************************************************************
+static void ADC_profileBegin(void)
+{
+    TA1CTL = TASSEL_2 + MC_2 + TACLR;       // SMCLK, continuous mode
+    adcProfileCycles = TA1R;
+}
+//*****************************************************************************
+static void ADC_profilePhase(const uint8_t adcPin, const uint8_t phase)
+{
+    uint16_t elapsed;
+    ADC_phaseStats* stats;
+    uint8_t i;
+
+    // La estabilizacion espera en LPM3, sin SMCLK: se mide con ACLK
+    if(phase == ADC_PHASE_SETTLE)
+        elapsed = (uint16_t)(TIMER_getTime() - adcProfileTicks);
+    else
+        elapsed = TA1R - adcProfileCycles;
+
+    for(i = 0; i < adcProfileCount; i++)
+        if(adcProfiles[i].adcPin == adcPin)
+            break;
+    if(i == adcProfileCount && adcProfileCount < ADC_PROFILE_SENSORS)
+    {
+        adcProfiles[i].adcPin = adcPin;
+        adcProfileCount++;
+    }
+
+    // Con la tabla llena no se registra
+    if(i < adcProfileCount)
+    {
+        stats = &adcProfiles[i].phase[phase];
+        if(stats->count == 0 || elapsed < stats->min)
+            stats->min = elapsed;
+        if(elapsed > stats->max)
+            stats->max = elapsed;
+        stats->sum += elapsed;
+        stats->count++;
+    }
+
+    // Marcas al final para no contar el registro en la fase siguiente
+    if(phase == ADC_PHASE_POWER_ON)
+        adcProfileTicks = TIMER_getTime();
+    adcProfileCycles = TA1R;
+}
+#endif
+//*****************************************************************************
 uint16_t ADC_getVref(void)
 {
+    ADC_PROFILE_BEGIN();
+
     // VREF - Configura el ADC
     ADC_initPort(ADCINCH_13);
+    ADC_PROFILE_PHASE(ADCINCH_13, ADC_PHASE_POWER_ON);
 
     // VREF - Habilita la referencia interna
     ADC_initVref();
+    ADC_PROFILE_PHASE(ADCINCH_13, ADC_PHASE_SETTLE);
 
     // VREF - Inicia la conversion
     ADC_start();
 
     // VREF - Detiene el ADC
     ADC_stop();
+    ADC_PROFILE_PHASE(ADCINCH_13, ADC_PHASE_CONVERT);
 
     // VREF - Detiene la Referencia Interna
     ADC_stopVref();
+    ADC_PROFILE_PHASE(ADCINCH_13, ADC_PHASE_POWER_OFF);
 
     return(ADCMEM0);
 }
 //*****************************************************************************
+uint16_t ADC_getVrefCached(void)
+{
+    if(!vrefValid || vrefAge >= vrefMaxAge)
+    {
+        vrefCache = ADC_getVref();
+        vrefAge = 0;
+        vrefValid = 1;
+        vrefWitnessValid = 0;               // Nueva base para la deriva
+    }
+    vrefAge++;
+
+    return(vrefCache);
+}
+//*****************************************************************************
+void ADC_setVrefMaxAge(const uint16_t maxAge)
+{
+    vrefMaxAge = maxAge;
+}
+//*****************************************************************************
+void ADC_checkVrefDrift(const uint16_t sample)
+{
+    uint16_t diff;
+
+    if(!vrefWitnessValid)
+    {
+        vrefWitness = sample;
+        vrefWitnessValid = 1;
+        return;
+    }
+
+    diff = (sample > vrefWitness) ? (sample - vrefWitness) : (vrefWitness - sample);
+    if(diff > ADC_VREF_DRIFT)
+        vrefValid = 0;                      // Se vuelve a medir la referencia
+}
+//*****************************************************************************
+uint16_t ADC_learnSettle(const ADC_sensor* sensor)
+{
+    uint16_t elapsed = 0;
+    uint16_t previous;
+    uint16_t sample;
+    uint16_t diff;
+
+    GPIO_powerOn(&sensor->vcc);
+
+    // Convierte hasta que dos conversiones seguidas coinciden
+    sample = ADC_convert(sensor->adcPin);
+    do
+    {
+        previous = sample;
+        delay_us(ADC_SETTLE_STEP_US);
+        elapsed += ADC_SETTLE_STEP_US;
+        sample = ADC_convert(sensor->adcPin);
+        diff = (sample > previous) ? (sample - previous) : (previous - sample);
+    } while(diff >= settleEpsilon && elapsed < ADC_SETTLE_MAX_US);
+
+    GPIO_powerOff(&sensor->vcc);
+    GPIO_powerOff(&sensor->data);
+
+    ADC_storeSettle(sensor->adcPin, elapsed);
+
+    return(sample);
+}
+//*****************************************************************************
+uint8_t ADC_isSettleLearned(const uint8_t adcPin)
+{
+    return(settleLearned[adcPin] != 0);
+}
+//*****************************************************************************
+uint16_t ADC_getSettleUs(const uint8_t adcPin)
+{
+    if(settleLearned[adcPin] == 0)
+        return(ADC_SETTLE_MS * 1000U);
+
+    return(settleLearned[adcPin] + ADC_SETTLE_MARGIN_US);
+}
+//*****************************************************************************
+void ADC_forgetSettle(const uint8_t adcPin)
+{
+    ADC_storeSettle(adcPin, 0);
+}
+//*****************************************************************************
+void ADC_setSettleEpsilon(const uint16_t epsilon)
+{
+    settleEpsilon = epsilon;
+}
+//*****************************************************************************
 uint16_t ADC_takeMeasure(const uint8_t adcPin, const uint8_t vccPort,
                          const uint8_t vccPin, const uint8_t dPort,
                          const uint8_t dPin)
 {
-    uint16_t adcInput;
+    uint16_t result;
+
+    ADC_PROFILE_BEGIN();
 
     // Alimantacin
     GPIO_powerOnSensor(vccPort, vccPin);
-    delay_ms(5);
+    ADC_PROFILE_PHASE(adcPin, ADC_PHASE_POWER_ON);
+    delay_us(ADC_getSettleUs(adcPin));
+    ADC_PROFILE_PHASE(adcPin, ADC_PHASE_SETTLE);
+
+    // Conversion
+    result = ADC_convert(adcPin);
+    ADC_PROFILE_PHASE(adcPin, ADC_PHASE_CONVERT);
+
+    // Apago el sensor
+    GPIO_powerOffSensor(vccPort, vccPin);
+    GPIO_powerOffSensor(dPort, dPin);
+    ADC_PROFILE_PHASE(adcPin, ADC_PHASE_POWER_OFF);
+
+    return (result);
+}
+//*****************************************************************************
+void ADC_scanChannels(const uint16_t channelMask, uint16_t* results)
+{
+    uint8_t highest = 15;
+    uint8_t count = 0;
+    uint16_t mask;
+
+    if(channelMask == 0)
+        return;
+
+    // Canal mas alto de la secuencia y cantidad de resultados
+    while(!(channelMask & (0x0001 << highest)))
+        highest--;
+    for(mask = channelMask; mask; mask &= mask - 1)
+        count++;
+
+    adcMode = ADC_MODE_SCAN;
+    adcChannel = highest;
+    adcScanMask = channelMask;
+    adcIndex = count - 1;                   // Se llena desde el final
+    adcResults = results;
+
+    // Inicializa los pines ADC externos (A0-A9)
+    ADC_initPin(channelMask & 0x03FF);
+
+    // Configura el ADC en modo secuencia de canales
+    ADC_initPort(highest);
+    ADCCTL1 |= ADCCONSEQ_1;                 // Sequence-of-channels
+
+    // Inicia la secuencia, ADC_ISR sale de LPM al convertir A0
+    ADC_start();
+
+    // Detiene el ADC
+    ADC_stop();
+
+    adcMode = ADC_MODE_SINGLE;
+}
+//*****************************************************************************
+void ADC_takeMeasures(const ADC_sensor* sensors, const uint8_t count,
+                      uint16_t* results)
+{
+    GPIO_group power;
+    uint16_t scan[16];
+    uint16_t channelMask = 0;
+    uint16_t settle = 0;
+    uint16_t below;
+    uint8_t index;
+    uint8_t i;
+
+    // Alimentacin de todos los sensores al mismo tiempo
+    GPIO_clearGroup(&power);
+    for(i = 0; i < count; i++)
+    {
+        GPIO_addToGroup(&power, &sensors[i].vcc);
+        channelMask |= 0x0001 << sensors[i].adcPin;
+        if(ADC_getSettleUs(sensors[i].adcPin) > settle)
+            settle = ADC_getSettleUs(sensors[i].adcPin);
+    }
+    GPIO_powerOnGroup(&power);
+    delay_us(settle);
+
+    // Convierte todas las entradas en una sola secuencia
+    ADC_scanChannels(channelMask, scan);
+
+    // Apago los sensores y ordeno los resultados
+    for(i = 0; i < count; i++)
+    {
+        GPIO_addToGroup(&power, &sensors[i].data);
+
+        index = 0;
+        for(below = channelMask & ((0x0001 << sensors[i].adcPin) - 1); below; below &= below - 1)
+            index++;
+        results[i] = scan[index];
+    }
+    GPIO_powerOffGroup(&power);
+}
+//*****************************************************************************
+uint8_t ADC_startAsync(const uint8_t adcPin, ADC_callback callback)
+{
+    if(adcState == ADC_STATE_BUSY)
+        return(STATUS_FAIL);
+
+    adcMode = ADC_MODE_ASYNC;
+    adcState = ADC_STATE_BUSY;
+    adcCallback = callback;
+
+    // Inicializa Pin ADC y configura el ADC
+    ADC_initPin(0x0001 << adcPin);
+    ADC_initPort(adcPin);
+
+    // Inicia la conversion sin entrar en LPM
+    ADCCTL0 |= ADCENC | ADCSC;
+    __bis_SR_register(GIE);
+
+    return(STATUS_SUCCESS);
+}
+//*****************************************************************************
+uint8_t ADC_poll(uint16_t* result)
+{
+    uint8_t state = adcState;
+
+    if(state == ADC_STATE_DONE)
+    {
+        *result = adcAsyncResult;
+        adcState = ADC_STATE_IDLE;
+    }
+
+    return(state);
+}
+//*****************************************************************************
+uint16_t ADC_takeOversampled(const uint8_t adcPin, uint8_t extraBits)
+{
+    if(extraBits > ADC_OVERSAMPLE_MAX_BITS)
+        extraBits = ADC_OVERSAMPLE_MAX_BITS;
+
+    adcMode = ADC_MODE_OVERSAMPLE;
+    adcSamples = 0x0001 << (2 * extraBits);     // 4^n conversiones
+    adcAccumulator = 0;
 
     // Inicializa Pin ADC
-    adcInput = 0x0001 << adcPin;
-    ADC_initPin(adcInput);
+    ADC_initPin(0x0001 << adcPin);
 
-    // Configura el ADC
+    // Configura el ADC en modo repetido de un canal
     ADC_initPort(adcPin);
+    ADCCTL1 |= ADCCONSEQ_2;                 // Repeat-single-channel
 
-    // Inicia la conversion
+    // Inicia las conversiones, ADC_ISR sale de LPM al completar 4^n
     ADC_start();
 
     // Detiene el ADC
     ADC_stop();
 
-    // Apago el sensor
-    GPIO_powerOffSensor(vccPort, vccPin);
-    GPIO_powerOffSensor(dPort, dPin);
+    adcMode = ADC_MODE_SINGLE;
+
+    // Decimacion: 4^n muestras aportan n bits
+    return((uint16_t)(adcAccumulator >> extraBits));
+}
+//*****************************************************************************
+void ADC_samplePeriodic(const uint8_t adcPin, const uint16_t period,
+                        uint16_t* buffer, const uint16_t length)
+{
+    if(length == 0)
+        return;
+
+    adcMode = ADC_MODE_PERIODIC;
+    adcSamples = length;
+    adcResults = buffer;
+
+    // Inicializa Pin ADC
+    ADC_initPin(0x0001 << adcPin);
 
-    return (ADCMEM0);
+    // Configura el ADC en modo repetido, disparado por el timer
+    ADC_initPort(adcPin);
+    ADCCTL1 |= ADC_TRIGGER_SOURCE | ADCCONSEQ_2;
+    ADCCTL0 |= ADCENC;
+
+    // Inicia el timer, ADC_ISR sale de LPM al completar las muestras
+    adcDone = 0;
+    ADC_initTrigger(period);
+    ADC_sleep();
+
+    // Detiene el ADC
+    ADC_stop();
+
+    adcMode = ADC_MODE_SINGLE;
+}
+//*****************************************************************************
+void ADC_startStream(const uint8_t adcPin, const uint16_t period,
+                     RINGBUF_buffer* ring, const uint16_t wakeLevel)
+{
+    adcMode = ADC_MODE_STREAM;
+    adcRing = ring;
+    adcWakeLevel = wakeLevel;
+
+    // Inicializa Pin ADC
+    ADC_initPin(0x0001 << adcPin);
+
+    // Configura el ADC en modo repetido, disparado por el timer
+    ADC_initPort(adcPin);
+    ADCCTL1 |= ADC_TRIGGER_SOURCE | ADCCONSEQ_2;
+    ADCCTL0 |= ADCENC;
+
+    // Inicia el timer, ADC_ISR guarda las muestras en el buffer
+    ADC_initTrigger(period);
+    __bis_SR_register(GIE);
+}
+//*****************************************************************************
+void ADC_stopStream(void)
+{
+    ADC_stopTrigger();
+    ADC_stop();
+
+    adcMode = ADC_MODE_SINGLE;
+}
+//*****************************************************************************
+uint8_t ADC_monitorWindow(const uint8_t adcPin, const uint16_t period,
+                          const uint16_t low, const uint16_t high,
+                          uint16_t* result)
+{
+    adcMode = ADC_MODE_WINDOW;
+    adcWindowEvent = 0;
+
+    // Inicializa Pin ADC
+    ADC_initPin(0x0001 << adcPin);
+
+    // Configura el ADC en modo repetido, disparado por el timer
+    ADC_initPort(adcPin);
+    ADCCTL1 |= ADC_TRIGGER_SOURCE | ADCCONSEQ_2;
+    ADCLO = low;                            // Window comparator limits
+    ADCHI = high;
+    ADCIFG &= ~(ADCHIIFG | ADCLOIFG);
+    ADCIE = ADCHIIE | ADCLOIE;              // Only wake outside the window
+    ADCCTL0 |= ADCENC;
+
+    // Inicia el timer, ADC_ISR sale de LPM al salir de la ventana
+    adcDone = 0;
+    ADC_initTrigger(period);
+    ADC_sleep();
+
+    // Detiene el ADC
+    ADC_stop();
+
+    adcMode = ADC_MODE_SINGLE;
+    *result = ADCMEM0;
+
+    return(adcWindowEvent);
+}
+#ifdef ADC_PROFILE
+//*****************************************************************************
+void ADC_profileStart(void)
+{
+    uint8_t i;
+
+    for(i = 0; i < ADC_PROFILE_SENSORS; i++)
+        adcProfiles[i] = (ADC_profile){ 0 };
+    adcProfileCount = 0;
+}
+//*****************************************************************************
+const ADC_profile* ADC_profileGet(const uint8_t adcPin)
+{
+    uint8_t i;
+
+    for(i = 0; i < adcProfileCount; i++)
+        if(adcProfiles[i].adcPin == adcPin)
+            return(&adcProfiles[i]);
+
+    return(0);
 }
+//*****************************************************************************
+void ADC_profileDump(void)
+{
+    uint8_t frame[ADC_PROFILE_PAYLOAD];
+    const ADC_phaseStats* stats;
+    uint16_t mean;
+    uint8_t i, phase;
+
+    for(i = 0; i < adcProfileCount; i++)
+    {
+        for(phase = 0; phase < ADC_PHASES; phase++)
+        {
+            stats = &adcProfiles[i].phase[phase];
+            if(stats->count == 0)
+                continue;
+
+            mean = (uint16_t)(stats->sum / stats->count);
+            frame[0] = adcProfiles[i].adcPin;
+            frame[1] = phase;
+            frame[2] = (uint8_t)stats->count;
+            frame[3] = (uint8_t)(stats->count >> 8);
+            frame[4] = (uint8_t)stats->min;
+            frame[5] = (uint8_t)(stats->min >> 8);
+            frame[6] = (uint8_t)stats->max;
+            frame[7] = (uint8_t)(stats->max >> 8);
+            frame[8] = (uint8_t)mean;
+            frame[9] = (uint8_t)(mean >> 8);
+
+            // Espera lugar en el buffer en vez de descartar la trama
+            while(EXPORT_TX_SIZE - EXPORT_pending() < EXPORT_FRAME_SIZE(ADC_PROFILE_PAYLOAD))
+                EXPORT_sleep();
+            EXPORT_send(EXPORT_PROFILE, frame, ADC_PROFILE_PAYLOAD);
+        }
+    }
+}
+#endif
 //****************************************************************************************************************************************************
 // ADC interrupt service routine
 #if defined(__TI_COMPILER_VERSION__) || defined(__IAR_SYSTEMS_ICC__)
@@ -124,14 +655,75 @@ void __attribute__ ((interrupt(ADC_VECTOR))) ADC_ISR (void)
         case ADCIV_ADCTOVIFG:
             break;
         case ADCIV_ADCHIIFG:
+            adcWindowEvent = ADC_WINDOW_ABOVE;
+            ADC_stopTrigger();
+            adcDone = 1;
+            __bic_SR_register_on_exit(LPM3_bits + GIE);   // Exit from LPM
             break;
         case ADCIV_ADCLOIFG:
+            adcWindowEvent = ADC_WINDOW_BELOW;
+            ADC_stopTrigger();
+            adcDone = 1;
+            __bic_SR_register_on_exit(LPM3_bits + GIE);   // Exit from LPM
             break;
         case ADCIV_ADCINIFG:
             break;
         case ADCIV_ADCIFG:
-            ADCIFG &= ~ADCIFG0;
-            __bic_SR_register_on_exit(LPM3_bits + GIE);   // Exit from LPM
+            switch(adcMode)
+            {
+                case ADC_MODE_SCAN:
+                    if(adcScanMask & (0x0001 << adcChannel))
+                        adcResults[adcIndex--] = ADCMEM0; // Clears ADCIFG0
+                    else
+                        ADCIFG &= ~ADCIFG0;
+
+                    if(adcChannel-- != 0)
+                        ADCCTL0 |= ADCSC;                 // Next channel
+                    else
+                    {
+                        adcDone = 1;
+                        __bic_SR_register_on_exit(LPM3_bits + GIE);
+                    }
+                    break;
+                case ADC_MODE_ASYNC:
+                    adcAsyncResult = ADCMEM0;             // Clears ADCIFG0
+                    ADC_stop();
+                    adcMode = ADC_MODE_SINGLE;
+                    adcState = ADC_STATE_DONE;
+                    if(adcCallback)
+                        adcCallback(adcAsyncResult);
+                    __bic_SR_register_on_exit(LPM3_bits); // Wake main loop, keep GIE
+                    break;
+                case ADC_MODE_PERIODIC:
+                    *adcResults++ = ADCMEM0;              // Clears ADCIFG0
+                    if(--adcSamples == 0)
+                    {
+                        ADC_stopTrigger();
+                        adcDone = 1;
+                        __bic_SR_register_on_exit(LPM3_bits + GIE);
+                    }
+                    break;
+                case ADC_MODE_STREAM:
+                    RINGBUF_put(adcRing, ADCMEM0);        // Clears ADCIFG0
+                    if(RINGBUF_count(adcRing) >= adcWakeLevel)
+                        __bic_SR_register_on_exit(LPM3_bits); // Wake main loop, keep GIE
+                    break;
+                case ADC_MODE_OVERSAMPLE:
+                    adcAccumulator += ADCMEM0;            // Clears ADCIFG0
+                    if(--adcSamples != 0)
+                        ADCCTL0 |= ADCSC;                 // Next sample
+                    else
+                    {
+                        adcDone = 1;
+                        __bic_SR_register_on_exit(LPM3_bits + GIE);
+                    }
+                    break;
+                default:
+                    ADCIFG &= ~ADCIFG0;
+                    adcDone = 1;
+                    __bic_SR_register_on_exit(LPM3_bits + GIE);   // Exit from LPM
+                    break;
+            }
             break;
         default:
             break;
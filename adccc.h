@@ -20,6 +20,239 @@
 #include "driverlib.h"
 #include "delay.h"
 #include "gpio.h"
+#include "ringbuf.h"
+#ifdef ADC_PROFILE
+#include "export.h"
+#endif
+
+//*****************************************************************************
+//                              Definiciones
+//*****************************************************************************
+//*****************************************************************************
+//! \details Tiempo en milisegundos que se espera luego de alimentar los
+//!          sensores antes de realizar la conversin.
+//*****************************************************************************
+#define ADC_SETTLE_MS 5
+
+//*****************************************************************************
+//! @name Estabilizacin adaptativa:
+//! \brief Parmetros de ADC_learnSettle(). El tiempo aprendido de cada
+//!        entrada se guarda en FRAM y reemplaza a \b ADC_SETTLE_MS.
+//! @{
+//*****************************************************************************
+//*****************************************************************************
+//! \details Diferencia mxima en cuentas entre dos conversiones seguidas para
+//!          considerar que la entrada se estabiliz. Configurable con
+//!          ADC_setSettleEpsilon().
+//*****************************************************************************
+#define ADC_SETTLE_EPSILON 4
+
+//*****************************************************************************
+//! \details Tiempo en microsegundos entre conversiones durante el
+//!          aprendizaje; es tambin la resolucin del tiempo aprendido.
+//*****************************************************************************
+#define ADC_SETTLE_STEP_US 250
+
+//*****************************************************************************
+//! \details Tiempo mximo de aprendizaje en microsegundos. Una entrada que no
+//!          converge se guarda con este tiempo.
+//*****************************************************************************
+#define ADC_SETTLE_MAX_US 20000
+
+//*****************************************************************************
+//! \details Margen en microsegundos que se suma al tiempo aprendido.
+//*****************************************************************************
+#define ADC_SETTLE_MARGIN_US 250
+
+//*****************************************************************************
+//! \details Cantidad de entradas del ADC (\b ADCINCH_0 a \b ADCINCH_15).
+//*****************************************************************************
+#define ADC_CHANNELS 16
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! \details Mxima cantidad de bits extra del sobremuestreo. Con 3 bits se
+//!          acumulan 64 conversiones y se obtiene un resultado de 13 bits.
+//*****************************************************************************
+#define ADC_OVERSAMPLE_MAX_BITS 3
+
+//*****************************************************************************
+//! \details Cantidad de llamadas a ADC_getVrefCached() que se utiliza la
+//!          conversin de la referencia guardada antes de volver a medirla.
+//*****************************************************************************
+#define ADC_VREF_MAX_AGE 16
+
+//*****************************************************************************
+//! \details Diferencia en cuentas del ADC a partir de la cual
+//!          ADC_checkVrefDrift() considera que la alimentacin cambi.
+//*****************************************************************************
+#define ADC_VREF_DRIFT 8
+
+//*****************************************************************************
+//! \details Fuente de la seal de muestreo para las conversiones peridicas.
+//!          En el MSP430FR413x \b ADCSHS_1 corresponde a la salida
+//!          \b TA1.1B del <b>Timer1_A3</b>.
+//*****************************************************************************
+#define ADC_TRIGGER_SOURCE ADC_SAMPLEHOLDSOURCE_1
+
+//*****************************************************************************
+//! \details Modo de bajo consumo de las esperas del ADC. Con \b ADC_PROFILE
+//!          se espera en \b LPM0 para que \b SMCLK, que mide las fases,
+//!          siga contando durante la conversin.
+//*****************************************************************************
+#ifdef ADC_PROFILE
+#define ADC_LPM_BITS LPM0_bits
+#else
+#define ADC_LPM_BITS LPM3_bits
+#endif
+
+//*****************************************************************************
+//! @name Estados de la conversin asincrnica:
+//! \brief Valores devueltos por ADC_poll().
+//! @{
+//*****************************************************************************
+//*****************************************************************************
+//! \details No hay ninguna conversin en curso ni resultado pendiente.
+//*****************************************************************************
+#define ADC_STATE_IDLE 0
+
+//*****************************************************************************
+//! \details La conversin est en curso.
+//*****************************************************************************
+#define ADC_STATE_BUSY 1
+
+//*****************************************************************************
+//! \details La conversin finaliz y el resultado an no fue ledo.
+//*****************************************************************************
+#define ADC_STATE_DONE 2
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! @name Eventos del comparador de ventana:
+//! \brief Valores devueltos por ADC_monitorWindow().
+//! @{
+//*****************************************************************************
+//*****************************************************************************
+//! \details La conversin super el lmite superior de la ventana.
+//*****************************************************************************
+#define ADC_WINDOW_ABOVE 1
+
+//*****************************************************************************
+//! \details La conversin qued por debajo del lmite inferior de la ventana.
+//*****************************************************************************
+#define ADC_WINDOW_BELOW 2
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+#ifdef ADC_PROFILE
+//*****************************************************************************
+//! @name Fases de una medicin:
+//! \brief Tramos que registra el modo de instrumentacin \b ADC_PROFILE en
+//!        ADC_takeMeasure() y ADC_getVref(). La estabilizacin se mide en
+//!        cuentas de \b ACLK y las dems fases en ciclos de \b SMCLK.
+//! @{
+//*****************************************************************************
+//*****************************************************************************
+//! \details Alimentacin del sensor. En ADC_getVref() es la configuracin del
+//!          ADC.
+//*****************************************************************************
+#define ADC_PHASE_POWER_ON 0
+
+//*****************************************************************************
+//! \details Espera hasta que la entrada es vlida: ADC_SETTLE_MS en los
+//!          sensores, \b REFGENRDY en la referencia interna.
+//*****************************************************************************
+#define ADC_PHASE_SETTLE 1
+
+//*****************************************************************************
+//! \details Conversin, desde la configuracin del pin hasta \b ADC_ISR.
+//*****************************************************************************
+#define ADC_PHASE_CONVERT 2
+
+//*****************************************************************************
+//! \details Apagado del sensor o de la referencia interna.
+//*****************************************************************************
+#define ADC_PHASE_POWER_OFF 3
+
+#define ADC_PHASES 4
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! \details Cantidad de entradas distintas de las que se guardan tiempos. Cada
+//!          una ocupa 42 bytes de RAM.
+//*****************************************************************************
+#define ADC_PROFILE_SENSORS 4
+
+//*****************************************************************************
+//! \details Bytes de datos de cada trama \b EXPORT_PROFILE de
+//!          ADC_profileDump(): entrada, fase y los campos de
+//!          \b ADC_phaseStats de 16 bits con el byte bajo primero, con la
+//!          media en lugar de la suma.
+//*****************************************************************************
+#define ADC_PROFILE_PAYLOAD 10
+#endif
+
+
+//*****************************************************************************
+//! \brief Funcin que se llama desde \b ADC_ISR al finalizar una conversin
+//!        asincrnica. Recibe el valor convertido.
+//*****************************************************************************
+typedef void (*ADC_callback)(uint16_t result);
+
+//*****************************************************************************
+//! \brief Descriptor de un sensor analgico alimentado por un pin.
+//!
+//! \details Agrupa los mismos parmetros que recibe ADC_takeMeasure() para
+//!          poder medir varios sensores en una sola llamada a
+//!          ADC_takeMeasures(). Los pines se inicializan con \b GPIO_PIN()
+//!          para que el puerto y la mscara se resuelvan en compilacin.
+//*****************************************************************************
+typedef struct ADC_sensor
+{
+    //! Entrada analgica del sensor (\b ADCINCH_x).
+    uint8_t adcPin;
+    //! Pin de alimentacin.
+    GPIO_pin vcc;
+    //! Pin de datos.
+    GPIO_pin data;
+} ADC_sensor;
+
+#ifdef ADC_PROFILE
+//*****************************************************************************
+//! \brief Estadstica de una fase: cuentas de TIMER_getTime() (\b ACLK,
+//!        \b TIMER_HZ) en \b ADC_PHASE_SETTLE, ciclos de \b SMCLK en las
+//!        dems.
+//*****************************************************************************
+typedef struct ADC_phaseStats
+{
+    uint16_t min;
+    uint16_t max;
+    //! Suma de todas las mediciones, la media es sum / count.
+    uint32_t sum;
+    uint16_t count;
+} ADC_phaseStats;
+
+//*****************************************************************************
+//! \brief Tiempos de todas las fases de una entrada analgica.
+//*****************************************************************************
+typedef struct ADC_profile
+{
+    //! Entrada analgica (\b ADCINCH_x). \b ADCINCH_13 es la referencia.
+    uint8_t adcPin;
+    ADC_phaseStats phase[ADC_PHASES];
+} ADC_profile;
+#endif
 
 //*****************************************************************************
 //                              Funciones Prototipos
@@ -73,6 +306,24 @@ static inline void ADC_initPin(const uint16_t adcInput);
 //*****************************************************************************
 static void ADC_initPort(const uint8_t adcInput);
 
+//*****************************************************************************
+//! \brief Espera en bajo consumo a que ADC_ISR indique el fin de la
+//!        operacin en curso.
+//!
+//! \details \b Descripcin \n
+//!          Repite la entrada en \b ADC_LPM_BITS hasta que ADC_ISR pone en 1
+//!          \b adcDone, ya que el servicio de temporizadores u otra
+//!          interrupcin puede despertar a la CPU antes. La bandera se consulta
+//!          con las interrupciones deshabilitadas para no perder el aviso
+//!          entre la consulta y la entrada en bajo consumo.
+//!
+//! \return \c void
+//!
+//! \attention Sale con las interrupciones deshabilitadas, igual que
+//!            ADC_ISR al despertar a la CPU.
+//*****************************************************************************
+static void ADC_sleep(void);
+
 //*****************************************************************************
 //! \brief Da comienzo a la conversion.
 //!
@@ -81,6 +332,8 @@ static void ADC_initPort(const uint8_t adcInput);
 //!          \b ADCCTL0. Ya finalizada la configuracin se inicia la
 //!          conversin mediante el bit \b ADCSC y se resetea automticamente.
 //!
+//!          Luego espera con ADC_sleep().
+//!
 //! \return \c void
 //!
 //! \atenttion Modifica los bits del registro \b ADCCTL0.
@@ -93,7 +346,8 @@ static inline void ADC_start(void);
 //! \details \b Descripcin \n
 //!          Se escribe \b 0A5h para desbloquear los registros \b PMM de control.
 //!          Luego se habilita la referencia interna en el registro \b PMMCTL2
-//!           y se espera que este disponible para ser usada.
+//!          y se espera que este disponible para ser usada consultando el bit
+//!          \b REFGENRDY, en lugar de esperar un tiempo fijo.
 //!
 //! \return \c void
 //!
@@ -129,6 +383,97 @@ static inline void ADC_stopVref(void);
 //*****************************************************************************
 static inline void ADC_stop(void);
 
+//*****************************************************************************
+//! \brief Convierte una entrada con el sensor ya alimentado.
+//!
+//! \details \b Descripcin \n
+//!          Habilita el pin, configura el ADC, convierte en \b LPM3 y detiene
+//!          el ADC. Es la conversin de ADC_takeMeasure() sin la
+//!          alimentacin del sensor.
+//!
+//! \param adcPin Entrada analgica (\b ADCINCH_x).
+//!
+//! \return \c La conversion obtenida.
+//*****************************************************************************
+static uint16_t ADC_convert(const uint8_t adcPin);
+
+//*****************************************************************************
+//! \brief Guarda en FRAM el tiempo de estabilizacin de una entrada.
+//!
+//! \details \b Descripcin \n
+//!          La tabla es persistente y queda en la FRAM de programa, protegida
+//!          por el bit \b PFWP del registro \b SYSCFG0. Se quita la
+//!          proteccin solo durante la escritura.
+//!
+//! \param adcPin Entrada analgica (\b ADCINCH_x).
+//! \param settleUs Tiempo en microsegundos, 0 para olvidarlo.
+//!
+//! \return \c void
+//!
+//! \attention Modifica el registro \b SYSCFG0.
+//*****************************************************************************
+static void ADC_storeSettle(const uint8_t adcPin, const uint16_t settleUs);
+
+//*****************************************************************************
+//! \brief Configura el timer que dispara las conversiones peridicas.
+//!
+//! \details \b Descripcin \n
+//!          Configura el <b>Timer1_A3</b> con \b ACLK en modo up contando
+//!          hasta \b TA1CCR0. La salida \b TA1.1 se configura en modo
+//!          reset/set, por lo que genera un flanco ascendente por perodo que
+//!          el \b ADC utiliza como seal de muestreo (\b ADC_TRIGGER_SOURCE).
+//!
+//! \param period Perodo de muestreo en ciclos de \b ACLK.
+//!
+//! \return \c void
+//!
+//! \attention Modifica los bits de los registros \b TA1CTL, \b TA1CCTL1,
+//!            \b TA1CCR0 y \b TA1CCR1.
+//*****************************************************************************
+static void ADC_initTrigger(const uint16_t period);
+
+//*****************************************************************************
+//! \brief Detiene el timer que dispara las conversiones peridicas.
+//!
+//! \return \c void
+//!
+//! \attention Modifica los bits del registro \b TA1CTL.
+//*****************************************************************************
+static inline void ADC_stopTrigger(void);
+
+#ifdef ADC_PROFILE
+//*****************************************************************************
+//! \brief Comienza a medir las fases de una medicin.
+//!
+//! \details \b Descripcin \n
+//!          Pone el <b>Timer1_A3</b> en modo continuo con \b SMCLK y toma la
+//!          primera marca.
+//!
+//! \return \c void
+//!
+//! \attention Modifica los bits del registro \b TA1CTL.
+//*****************************************************************************
+static void ADC_profileBegin(void);
+
+//*****************************************************************************
+//! \brief Cierra una fase de la medicin.
+//!
+//! \details \b Descripcin \n
+//!          Suma el tiempo transcurrido desde la marca anterior a la fase
+//!          \p phase de la entrada \p adcPin. \b ADC_PHASE_SETTLE se mide
+//!          con TIMER_getTime() desde el fin de \b ADC_PHASE_POWER_ON, ya que
+//!          la espera puede ser en \b LPM3; las dems fases con el
+//!          \b TA1R. Las marcas se toman al final, as el registro no se
+//!          cuenta en la fase siguiente.
+//!
+//! \param adcPin Entrada analgica medida.
+//! \param phase Fase que termina, \b ADC_PHASE_x.
+//!
+//! \return \c void
+//*****************************************************************************
+static void ADC_profilePhase(const uint8_t adcPin, const uint8_t phase);
+#endif
+
 //*****************************************************************************
 //! \brief Funcin que permite obtener el voltaje de bangap.
 //!
@@ -141,11 +486,116 @@ static inline void ADC_stop(void);
 //*****************************************************************************
 uint16_t ADC_getVref(void);
 
+//*****************************************************************************
+//! \brief Funcin que obtiene la conversin de la referencia interna sin
+//!        volver a medirla en cada llamada.
+//!
+//! \details \b Descripcin \n
+//!          Habilitar la referencia interna es uno de los pasos ms costosos
+//!          del ciclo de medicin y la tensin de alimentacin vara
+//!          lentamente. Por eso se guarda la ltima conversin obtenida con
+//!          ADC_getVref() y solo se vuelve a medir cuando pasaron ms de
+//!          \b ADC_VREF_MAX_AGE llamadas (configurable con
+//!          ADC_setVrefMaxAge()) o cuando ADC_checkVrefDrift() detect un
+//!          cambio.
+//!
+//! \return \c La conversion de la referencia interna.
+//*****************************************************************************
+uint16_t ADC_getVrefCached(void);
+
+//*****************************************************************************
+//! \brief Configura cada cuntas llamadas a ADC_getVrefCached() se vuelve a
+//!        medir la referencia.
+//!
+//! \param maxAge Cantidad de llamadas que se utiliza el valor guardado.
+//!
+//! \return \c void
+//*****************************************************************************
+void ADC_setVrefMaxAge(const uint16_t maxAge);
+
+//*****************************************************************************
+//! \brief Verifica si la alimentacin pudo haber cambiado a partir de una
+//!        conversin que ya se realiza en cada ciclo.
+//!
+//! \details \b Descripcin \n
+//!          Recibe la conversin de una entrada de tensin estable (por
+//!          ejemplo el divisor de la batera) tomada con \b AVCC como
+//!          referencia. La primera conversin luego de medir la referencia se
+//!          guarda como base; si una conversin posterior difiere en ms de
+//!          \b ADC_VREF_DRIFT cuentas la referencia guardada se descarta y la
+//!          prxima llamada a ADC_getVrefCached() la vuelve a medir.
+//!
+//! \param sample Conversin en crudo de la entrada utilizada como testigo.
+//!
+//! \return \c void
+//*****************************************************************************
+void ADC_checkVrefDrift(const uint16_t sample);
+
+//*****************************************************************************
+//! \brief Funcin que aprende el tiempo de estabilizacin de un sensor.
+//!
+//! \details \b Descripcin \n
+//!          Alimenta el sensor y convierte su entrada cada
+//!          \b ADC_SETTLE_STEP_US hasta que dos conversiones seguidas difieren
+//!          en menos de \b ADC_SETTLE_EPSILON cuentas, o hasta
+//!          \b ADC_SETTLE_MAX_US. El tiempo transcurrido se guarda en FRAM,
+//!          por lo que se conserva sin alimentacin, y a partir de ah
+//!          ADC_getSettleUs() devuelve ese tiempo ms \b ADC_SETTLE_MARGIN_US.
+//!          Por ltimo apaga el sensor.
+//!
+//! \note El tiempo cuenta las esperas entre conversiones; la duracin de
+//!       cada conversin queda cubierta por el margen.
+//!
+//! \param sensor Descriptor del sensor.
+//!
+//! \return \c La ultima conversion obtenida.
+//*****************************************************************************
+uint16_t ADC_learnSettle(const ADC_sensor* sensor);
+
+//*****************************************************************************
+//! \brief Indica si una entrada tiene un tiempo de estabilizacin aprendido.
+//!
+//! \param adcPin Entrada analgica (\b ADCINCH_x).
+//!
+//! \return \c 1 si fue aprendido con ADC_learnSettle(), 0 si no.
+//*****************************************************************************
+uint8_t ADC_isSettleLearned(const uint8_t adcPin);
+
+//*****************************************************************************
+//! \brief Tiempo de estabilizacin de una entrada.
+//!
+//! \param adcPin Entrada analgica (\b ADCINCH_x).
+//!
+//! \return \c El tiempo aprendido ms \b ADC_SETTLE_MARGIN_US, o
+//!         \b ADC_SETTLE_MS si no fue aprendido, en microsegundos.
+//*****************************************************************************
+uint16_t ADC_getSettleUs(const uint8_t adcPin);
+
+//*****************************************************************************
+//! \brief Borra el tiempo aprendido de una entrada para volver a aprenderlo,
+//!        por ejemplo luego de cambiar el sensor.
+//!
+//! \param adcPin Entrada analgica (\b ADCINCH_x).
+//!
+//! \return \c void
+//*****************************************************************************
+void ADC_forgetSettle(const uint8_t adcPin);
+
+//*****************************************************************************
+//! \brief Configura la diferencia que ADC_learnSettle() considera estable.
+//!
+//! \param epsilon Diferencia mxima en cuentas entre conversiones seguidas.
+//!
+//! \return \c void
+//*****************************************************************************
+void ADC_setSettleEpsilon(const uint16_t epsilon);
+
 //*****************************************************************************
 //! \brief Funcin que permite tomar una medida de una entrada analgica.
 //!
 //! \details \b Descripcin \n
 //!          Realiza la secuencia de configuracin para tomar una medida.
+//!          Espera ADC_getSettleUs() luego de alimentar el sensor.
 //!
 //! \param adcPin Pin deseado de donde se desea obtener el valor de conversion.
 //! \param vccPort Puerto elegido para alimentar el sensor mediante un pin.
@@ -159,4 +609,254 @@ uint16_t ADC_takeMeasure(const uint8_t adcPin, const uint8_t vccPort,
                          const uint8_t vccPin, const uint8_t dPort,
                          const uint8_t dPin);
 
+//*****************************************************************************
+//! \brief Funcin que convierte un conjunto de entradas analgicas en un nico
+//!        ciclo de habilitacin del ADC.
+//!
+//! \details \b Descripcin \n
+//!          Configura el \b ADC una sola vez en modo secuencia de canales
+//!          (\b ADCCONSEQ_1) comenzando por el canal ms alto de la mscara.
+//!          El hardware recorre los canales en forma descendente hasta
+//!          \b A0 y en cada interrupcin \b ADC_ISR guarda el resultado si el
+//!          canal pertenece a la mscara y dispara la siguiente conversin
+//!          con \b ADCSC, por lo que no hay riesgo de sobreescritura de
+//!          \b ADCMEM0. La CPU permanece en \b LPM3 durante toda la secuencia
+//!          y se evita reconfigurar y reiniciar el ADC por cada canal como
+//!          ocurre con ADC_takeMeasure().
+//!
+//! \param channelMask Mscara de canales a convertir, el bit \b n
+//!                    corresponde al canal \b An (\b ADCINCH_n).
+//! \param results Arreglo donde se guardan las conversiones en orden
+//!                ascendente de canal. Debe tener tantos elementos como bits
+//!                en uno tenga \p channelMask.
+//!
+//! \return \c void
+//!
+//! \attention Modifica los bits de los registros \b SYSCFG2, \b ADCCTLx,
+//!            \b ADCIE y \b ADCMCTL0. Los sensores deben estar alimentados
+//!            antes de llamar a esta funcin.
+//*****************************************************************************
+void ADC_scanChannels(const uint16_t channelMask, uint16_t* results);
+
+//*****************************************************************************
+//! \brief Funcin que toma una medida de varios sensores compartiendo el
+//!        tiempo de estabilizacin.
+//!
+//! \details \b Descripcin \n
+//!          Alimenta todos los sensores juntos, espera una nica vez el
+//!          mayor ADC_getSettleUs() de los sensores y convierte todas las
+//!          entradas seguidas mediante ADC_scanChannels(). Por ltimo apaga
+//!          todos los sensores. De esta
+//!          forma el tiempo de estabilizacin no se multiplica por la
+//!          cantidad de sensores como ocurre al llamar varias veces a
+//!          ADC_takeMeasure().
+//!
+//! \param sensors Arreglo de descriptores de los sensores a medir.
+//! \param count Cantidad de sensores en \p sensors.
+//! \param results Arreglo donde se guarda la conversion de cada sensor, en el
+//!                mismo orden que \p sensors.
+//!
+//! \return \c void
+//*****************************************************************************
+void ADC_takeMeasures(const ADC_sensor* sensors, const uint8_t count,
+                      uint16_t* results);
+
+//*****************************************************************************
+//! \brief Funcin que inicia una conversin sin bloquear a la CPU.
+//!
+//! \details \b Descripcin \n
+//!          Configura el \b ADC e inicia la conversin pero, a diferencia de
+//!          ADC_takeMeasure(), no entra en \b LPM3 esperando el resultado.
+//!          Cuando la conversin finaliza \b ADC_ISR guarda el resultado,
+//!          detiene el ADC, llama a \p callback (si no es \c NULL) y saca a la
+//!          CPU de bajo consumo dejando habilitadas las interrupciones. De
+//!          esta forma el programa principal puede realizar otras tareas
+//!          mientras dura la conversin y consultar el estado con ADC_poll().
+//!
+//! \param adcPin Pin deseado de donde se desea obtener el valor de conversion.
+//! \param callback Funcin llamada desde \b ADC_ISR con el resultado, puede
+//!                 ser \c NULL si se utiliza nicamente ADC_poll().
+//!
+//! \return \c STATUS_SUCCESS si se inici la conversin o \c STATUS_FAIL si
+//!         ya haba una conversin asincrnica en curso.
+//!
+//! \attention El sensor debe estar alimentado antes de llamar a esta funcin.
+//!            \p callback se ejecuta en contexto de interrupcin.
+//*****************************************************************************
+uint8_t ADC_startAsync(const uint8_t adcPin, ADC_callback callback);
+
+//*****************************************************************************
+//! \brief Funcin que consulta el estado de la conversin asincrnica.
+//!
+//! \details \b Descripcin \n
+//!          Devuelve el estado de la conversin iniciada con ADC_startAsync().
+//!          Si la conversin finaliz copia el resultado en \p result y el
+//!          estado vuelve a \b ADC_STATE_IDLE.
+//!
+//! \param result Puntero donde se guarda la conversin si est disponible.
+//!
+//! \return \c ADC_STATE_IDLE, \c ADC_STATE_BUSY o \c ADC_STATE_DONE.
+//*****************************************************************************
+uint8_t ADC_poll(uint16_t* result);
+
+//*****************************************************************************
+//! \brief Funcin que obtiene una conversin de mayor resolucin mediante
+//!        sobremuestreo y decimacin.
+//!
+//! \details \b Descripcin \n
+//!          Configura el \b ADC en modo repetido de un canal
+//!          (\b ADCCONSEQ_2) y realiza \b 4^n conversiones. \b ADC_ISR
+//!          acumula cada resultado y dispara la siguiente conversin, por lo
+//!          que la CPU permanece en \b LPM3 entre muestras. Al finalizar la
+//!          suma se desplaza \b n bits a la derecha obteniendo un resultado
+//!          de <b>10 + n</b> bits con menor ruido.
+//!
+//! \param adcPin Pin deseado de donde se desea obtener el valor de conversion.
+//! \param extraBits Bits de resolucin adicionales \b n (1 a
+//!                  \b ADC_OVERSAMPLE_MAX_BITS).
+//!
+//! \return \c La conversion decimada de <b>10 + n</b> bits.
+//!
+//! \attention El sensor debe estar alimentado antes de llamar a esta funcin.
+//*****************************************************************************
+uint16_t ADC_takeOversampled(const uint8_t adcPin, uint8_t extraBits);
+
+//*****************************************************************************
+//! \brief Funcin que toma muestras de una entrada a intervalos regulares
+//!        disparadas por hardware.
+//!
+//! \details \b Descripcin \n
+//!          Configura el \b ADC en modo repetido de un canal con la seal de
+//!          muestreo proveniente del timer (\b ADC_TRIGGER_SOURCE) en lugar
+//!          del bit \b ADCSC. Cada perodo el timer inicia una conversin sin
+//!          intervencin de la CPU, que permanece en \b LPM3, y \b ADC_ISR
+//!          nicamente guarda el resultado. Al completar \p length muestras
+//!          se detienen el timer y el ADC. El intervalo entre muestras queda
+//!          definido por el hardware, sin el jitter de iniciar cada
+//!          conversin por software.
+//!
+//! \param adcPin Pin deseado de donde se desea obtener el valor de conversion.
+//! \param period Perodo de muestreo en ciclos de \b ACLK.
+//! \param buffer Arreglo donde se guardan las muestras.
+//! \param length Cantidad de muestras a tomar.
+//!
+//! \return \c void
+//!
+//! \attention El sensor debe estar alimentado antes de llamar a esta funcin.
+//!            Utiliza el <b>Timer1_A3</b>.
+//*****************************************************************************
+void ADC_samplePeriodic(const uint8_t adcPin, const uint16_t period,
+                        uint16_t* buffer, const uint16_t length);
+
+//*****************************************************************************
+//! \brief Funcin que inicia la adquisicin continua de una entrada hacia un
+//!        buffer circular.
+//!
+//! \details \b Descripcin \n
+//!          Igual que ADC_samplePeriodic() las conversiones son disparadas por
+//!          el timer, pero la funcin retorna inmediatamente y la adquisicin
+//!          contina hasta llamar a ADC_stopStream(). \b ADC_ISR agrega cada
+//!          muestra en \p ring y solo saca a la CPU de bajo consumo cuando el
+//!          buffer alcanza \p wakeLevel muestras, de modo que el programa
+//!          principal puede procesar las muestras en bloques a su propio
+//!          ritmo. Las muestras que no entran en el buffer se contabilizan en
+//!          \b overruns.
+//!
+//! \param adcPin Pin deseado de donde se desea obtener el valor de conversion.
+//! \param period Perodo de muestreo en ciclos de \b ACLK.
+//! \param ring Buffer circular inicializado con RINGBUF_init().
+//! \param wakeLevel Cantidad de muestras en el buffer a partir de la cual se
+//!                  despierta a la CPU.
+//!
+//! \return \c void
+//!
+//! \attention El sensor debe estar alimentado antes de llamar a esta funcin.
+//!            Utiliza el <b>Timer1_A3</b>.
+//*****************************************************************************
+void ADC_startStream(const uint8_t adcPin, const uint16_t period,
+                     RINGBUF_buffer* ring, const uint16_t wakeLevel);
+
+//*****************************************************************************
+//! \brief Funcin que detiene la adquisicin continua.
+//!
+//! \return \c void
+//*****************************************************************************
+void ADC_stopStream(void);
+
+//*****************************************************************************
+//! \brief Funcin que vigila una entrada y despierta a la CPU solo cuando
+//!        sale de una ventana de valores.
+//!
+//! \details \b Descripcin \n
+//!          Configura las conversiones peridicas disparadas por el timer y
+//!          carga los lmites en los registros \b ADCLO y \b ADCHI del
+//!          comparador de ventana. Solo se habilitan las interrupciones
+//!          \b ADCHIIE y \b ADCLOIE, por lo que el ADC sigue muestreando en
+//!          hardware mientras la CPU permanece en \b LPM3 y \b ADC_ISR la
+//!          despierta nicamente cuando la conversin sale de la ventana,
+//!          por ejemplo cuando la batera cae por debajo de un umbral.
+//!
+//! \param adcPin Pin deseado de donde se desea obtener el valor de conversion.
+//! \param period Perodo de muestreo en ciclos de \b ACLK.
+//! \param low Lmite inferior de la ventana en cuentas del ADC.
+//! \param high Lmite superior de la ventana en cuentas del ADC.
+//! \param result Puntero donde se guarda la conversin que sali de la
+//!               ventana.
+//!
+//! \return \c ADC_WINDOW_ABOVE o \c ADC_WINDOW_BELOW.
+//!
+//! \attention El sensor debe estar alimentado mientras dure el monitoreo.
+//!            Utiliza el <b>Timer1_A3</b>.
+//*****************************************************************************
+uint8_t ADC_monitorWindow(const uint8_t adcPin, const uint16_t period,
+                          const uint16_t low, const uint16_t high,
+                          uint16_t* result);
+
+#ifdef ADC_PROFILE
+//*****************************************************************************
+//! \brief Inicia el modo de instrumentacin de las mediciones.
+//!
+//! \details \b Descripcin \n
+//!          Borra los tiempos guardados. A partir de aqu ADC_takeMeasure() y
+//!          ADC_getVref() registran mnimo, mximo y media de cada fase por
+//!          entrada analgica. El encendido, la conversin y el apagado duran
+//!          pocos microsegundos y se miden en ciclos de \b SMCLK con el
+//!          <b>Timer1_A3</b>; para que cuente durante la conversin las
+//!          esperas del ADC son en \b LPM0 (\b ADC_LPM_BITS). La
+//!          estabilizacin espera en \b LPM3 y se mide con TIMER_getTime(),
+//!          en cuentas de \b ACLK de 30,5 us. Solo se compila definiendo
+//!          \b ADC_PROFILE.
+//!
+//! \return \c void
+//!
+//! \attention Cada medicin reconfigura el <b>Timer1_A3</b>, por lo que no
+//!            debe medirse durante ADC_startStream() ni ADC_monitorWindow().
+//*****************************************************************************
+void ADC_profileStart(void);
+
+//*****************************************************************************
+//! \brief Devuelve los tiempos registrados de una entrada analgica.
+//!
+//! \param adcPin Entrada analgica (\b ADCINCH_x).
+//!
+//! \return \c Puntero a los tiempos o \c 0 si la entrada no se midi.
+//*****************************************************************************
+const ADC_profile* ADC_profileGet(const uint8_t adcPin);
+
+//*****************************************************************************
+//! \brief Enva los tiempos registrados con EXPORT_send().
+//!
+//! \details \b Descripcin \n
+//!          Una trama \b EXPORT_PROFILE de \b ADC_PROFILE_PAYLOAD bytes por
+//!          fase y entrada. El eUSCI_A0 es de export.h, por lo que antes debe
+//!          llamarse a EXPORT_init(). Si el buffer de transmisin est lleno
+//!          espera con EXPORT_sleep() en lugar de descartar tramas.
+//!
+//! \return \c void
+//!
+//! \attention Sale con las interrupciones habilitadas si tuvo que esperar.
+//*****************************************************************************
+void ADC_profileDump(void);
+#endif
+
 #endif /* ADCCC_H_ */
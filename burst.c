@@ -0,0 +1,179 @@
+/*
+ * burst.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Matas Lpez - Jess Lpez
+ */
+//*****************************************************************************
+//
+// burst.c - Envo de bloques de muestras por SPI en rfagas.
+//
+//*****************************************************************************
+
+#include "burst.h"
+
+//*****************************************************************************
+//                              Variables
+//*****************************************************************************
+static uint16_t                burstBlock[2][BURST_SAMPLES];
+static uint8_t                 burstFill;       // Bloque que se llena
+static uint8_t                 burstCount;      // Muestras del bloque que se llena
+static const uint8_t* volatile burstTx;         // Prximo byte, 0 sin envo
+static const uint8_t*          burstTxEnd;
+static uint16_t                burstOverruns;
+static uint32_t                burstSourceHz;   // SMCLK
+
+//*****************************************************************************
+static void BURST_swap(const uint8_t samples)
+{
+    burstTx = (const uint8_t*)burstBlock[burstFill];
+    burstTxEnd = burstTx + 2 * samples;
+    burstFill ^= 1;
+    burstCount = 0;
+
+    UCB0IE |= UCTXIE;                       // UCTXIFG ya est activo
+}
+//*****************************************************************************
+uint8_t BURST_init(const uint32_t clockHz)
+{
+    EUSCI_B_SPI_initMasterParam param = {0};
+
+    burstSourceHz = CS_getSMCLK();
+    if(clockHz == 0 || clockHz > burstSourceHz)
+        return(STATUS_FAIL);
+
+    burstFill = 0;
+    burstCount = 0;
+    burstTx = 0;
+    burstOverruns = 0;
+
+    param.selectClockSource = EUSCI_B_SPI_CLOCKSOURCE_SMCLK;
+    param.clockSourceFrequency = burstSourceHz;
+    param.desiredSpiClock = clockHz;
+    param.msbFirst = EUSCI_B_SPI_MSB_FIRST;
+    param.clockPhase = EUSCI_B_SPI_PHASE_DATA_CAPTURED_ONFIRST_CHANGED_ON_NEXT;
+    param.clockPolarity = EUSCI_B_SPI_CLOCKPOLARITY_INACTIVITY_LOW;
+    param.spiMode = EUSCI_B_SPI_3PIN;
+
+    P5SEL0 |= BIT1 | BIT2;                  // UCB0CLK y UCB0SIMO
+
+    EUSCI_B_SPI_initMaster(EUSCI_B0_BASE, &param);
+    EUSCI_B_SPI_enable(EUSCI_B0_BASE);
+
+    return(STATUS_SUCCESS);
+}
+//*****************************************************************************
+uint8_t BURST_setClock(const uint32_t clockHz)
+{
+    EUSCI_B_SPI_changeMasterClockParam param;
+    uint16_t gie = __get_SR_register() & GIE;
+    uint8_t status = STATUS_FAIL;
+
+    if(clockHz == 0 || clockHz > burstSourceHz)
+        return(STATUS_FAIL);
+
+    param.clockSourceFrequency = burstSourceHz;
+    param.desiredSpiClock = clockHz;
+
+    __disable_interrupt();
+    if(!BURST_isSending())
+    {
+        EUSCI_B_SPI_changeMasterClock(EUSCI_B0_BASE, &param);
+        status = STATUS_SUCCESS;
+    }
+    __bis_SR_register(gie);
+
+    return(status);
+}
+//*****************************************************************************
+uint8_t BURST_put(const uint16_t sample)
+{
+    uint16_t gie = __get_SR_register() & GIE;
+    uint8_t status = STATUS_SUCCESS;
+
+    __disable_interrupt();
+    if(burstCount == BURST_SAMPLES)
+    {
+        burstOverruns++;                    // Los dos bloques ocupados
+        status = STATUS_FAIL;
+    }
+    else
+    {
+        burstBlock[burstFill][burstCount++] = sample;
+        if(burstCount == BURST_SAMPLES && !burstTx)
+            BURST_swap(BURST_SAMPLES);
+    }
+    __bis_SR_register(gie);
+
+    return(status);
+}
+//*****************************************************************************
+uint8_t BURST_flush(void)
+{
+    uint16_t gie = __get_SR_register() & GIE;
+    uint8_t status = STATUS_FAIL;
+
+    __disable_interrupt();
+    if(burstCount && !burstTx)
+    {
+        BURST_swap(burstCount);
+        status = STATUS_SUCCESS;
+    }
+    __bis_SR_register(gie);
+
+    return(status);
+}
+//*****************************************************************************
+uint8_t BURST_isSending(void)
+{
+    return(burstTx || (UCB0STATW & UCBUSY));
+}
+//*****************************************************************************
+uint16_t BURST_takeOverruns(void)
+{
+    uint16_t gie = __get_SR_register() & GIE;
+    uint16_t overruns;
+
+    __disable_interrupt();
+    overruns = burstOverruns;
+    burstOverruns = 0;
+    __bis_SR_register(gie);
+
+    return(overruns);
+}
+//***************************************************************************************************************
+// eUSCI_B0 interrupt service routine
+#if defined(__TI_COMPILER_VERSION__) || defined(__IAR_SYSTEMS_ICC__)
+#pragma vector = USCI_B0_VECTOR
+__interrupt void USCI_B0_ISR(void)
+#elif defined(__GNUC__)
+void __attribute__ ((interrupt(USCI_B0_VECTOR))) USCI_B0_ISR (void)
+#else
+#error Compiler not supported!
+#endif
+{
+    const uint8_t* tx;
+
+    switch(__even_in_range(UCB0IV, USCI_SPI_UCTXIFG))
+    {
+        case USCI_SPI_UCTXIFG:
+            // Rfaga: se carga UCB0TXBUF mientras lo acepte, sin volver a entrar
+            tx = burstTx;
+            do
+                UCB0TXBUF = *tx++;
+            while(tx != burstTxEnd && (UCB0IFG & UCTXIFG));
+            burstTx = tx;
+
+            if(tx == burstTxEnd)
+            {
+                burstTx = 0;
+                UCB0IE &= ~UCTXIE;
+                // El otro bloque se complet durante el envo
+                if(burstCount == BURST_SAMPLES)
+                    BURST_swap(BURST_SAMPLES);
+            }
+            break;
+        default:
+            break;
+    }
+}
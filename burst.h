@@ -0,0 +1,129 @@
+/**
+  * @file     burst.h
+  * @brief    Envo de bloques de muestras por SPI en rfagas.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// burst.h - Dos bloques en RAM alternados (ping-pong): uno se llena con
+//           muestras mientras la interrupcin del eUSCI_B0 enva el otro.
+//
+//*****************************************************************************
+
+#ifndef BURST_H_
+#define BURST_H_
+
+//*****************************************************************************
+//                              Include
+//*****************************************************************************
+#include "driverlib.h"
+
+//*****************************************************************************
+//                              Definiciones
+//*****************************************************************************
+//*****************************************************************************
+//! \details Muestras de cada bloque. Los dos bloques ocupan
+//!          4 * \b BURST_SAMPLES bytes de RAM.
+//*****************************************************************************
+#define BURST_SAMPLES 32
+
+//*****************************************************************************
+//! \details Reloj SPI por defecto en Hz, se cambia con BURST_setClock().
+//*****************************************************************************
+#ifndef BURST_CLOCK_HZ
+#define BURST_CLOCK_HZ 1000000UL
+#endif
+
+//*****************************************************************************
+//                              Funciones Prototipos
+//*****************************************************************************
+//*****************************************************************************
+//! \brief Pasa el bloque lleno a envo y contina llenando el otro.
+//!
+//! \param samples Muestras del bloque a enviar.
+//!
+//! \return \c void
+//!
+//! \attention Se llama con las interrupciones deshabilitadas o desde
+//!            \b USCI_B0_ISR.
+//*****************************************************************************
+static void BURST_swap(const uint8_t samples);
+
+//*****************************************************************************
+//! \brief Inicializa el eUSCI_B0 como maestro SPI de 3 hilos con SMCLK.
+//!
+//! \details \b Descripcin \n
+//!          MSB primero, reloj en bajo en reposo y dato tomado en el primer
+//!          flanco. Configura P5.1 como UCB0CLK y P5.2 como UCB0SIMO. El
+//!          esclavo recibe cada muestra con el byte bajo primero.
+//!
+//! \param clockHz Reloj SPI en Hz, normalmente \b BURST_CLOCK_HZ. El divisor
+//!                es entero, por lo que se usa el ms cercano por encima.
+//!
+//! \return \c STATUS_SUCCESS o \c STATUS_FAIL si \p clockHz es 0 o mayor
+//!         que SMCLK.
+//*****************************************************************************
+uint8_t BURST_init(const uint32_t clockHz);
+
+//*****************************************************************************
+//! \brief Cambia el reloj SPI con EUSCI_B_SPI_changeMasterClock().
+//!
+//! \details \b Descripcin \n
+//!          Solo entre bloques: el cambio pasa el mdulo por reset y se
+//!          perdera el byte en curso.
+//!
+//! \param clockHz Reloj SPI en Hz.
+//!
+//! \return \c STATUS_SUCCESS o \c STATUS_FAIL si hay un bloque en envo o
+//!         \p clockHz no es vlido.
+//*****************************************************************************
+uint8_t BURST_setClock(const uint32_t clockHz);
+
+//*****************************************************************************
+//! \brief Agrega una muestra al bloque que se est llenando.
+//!
+//! \details \b Descripcin \n
+//!          Al completar el bloque lo pasa a envo si el otro ya termin; si
+//!          no, el bloque espera completo y lo inicia la interrupcin al
+//!          terminar. Nunca espera al SPI: si los dos bloques estn ocupados
+//!          la muestra se descarta y se cuenta. Se puede llamar desde el
+//!          programa principal o desde una interrupcin; con
+//!          ADC_startStream() el programa pasa a bloques las muestras del
+//!          buffer circular al despertar.
+//!
+//! \param sample Muestra.
+//!
+//! \return \c STATUS_SUCCESS o \c STATUS_FAIL si se descart.
+//*****************************************************************************
+uint8_t BURST_put(const uint16_t sample);
+
+//*****************************************************************************
+//! \brief Enva el bloque incompleto, por ejemplo al terminar una
+//!        adquisicin.
+//!
+//! \return \c STATUS_SUCCESS o \c STATUS_FAIL si hay un bloque en envo o el
+//!         bloque est vaco.
+//*****************************************************************************
+uint8_t BURST_flush(void);
+
+//*****************************************************************************
+//! \brief Indica si hay un bloque en envo.
+//!
+//! \details \b Descripcin \n
+//!          SMCLK se detiene en LPM3, por lo que mientras devuelva 1 el
+//!          programa debe esperar en LPM0 o en activo.
+//!
+//! \return \c 1 si hay un bloque en envo o un byte saliendo.
+//*****************************************************************************
+uint8_t BURST_isSending(void);
+
+//*****************************************************************************
+//! \brief Obtiene y reinicia el contador de muestras descartadas.
+//!
+//! \return \c Muestras descartadas desde la ltima consulta.
+//*****************************************************************************
+uint16_t BURST_takeOverruns(void);
+
+#endif /* BURST_H_ */
@@ -0,0 +1,257 @@
+/*
+ * codec.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Matas Lpez - Jess Lpez
+ */
+//*****************************************************************************
+//
+// codec.c - Compresin sin prdida de secuencias de muestras del ADC.
+//
+//*****************************************************************************
+
+#include "codec.h"
+
+//*****************************************************************************
+static void CODEC_initModel(CODEC_model* model)
+{
+    model->sum = 4;
+    model->symbols = 1;
+    model->k = 2;
+}
+//*****************************************************************************
+static void CODEC_adapt(CODEC_model* model, const uint16_t value)
+{
+    if(model->symbols == CODEC_RESET)
+    {
+        model->sum >>= 1;
+        model->symbols >>= 1;
+    }
+    model->sum += value;
+    model->symbols++;
+
+    for(model->k = 0; ((uint32_t)model->symbols << model->k) < model->sum && model->k < CODEC_K_MAX; model->k++)
+        ;
+}
+//*****************************************************************************
+static uint8_t CODEC_riceBits(const uint16_t value, const uint8_t k)
+{
+    if((value >> k) >= CODEC_ESCAPE)
+        return(CODEC_ESCAPE + 16);
+
+    return((uint8_t)((value >> k) + 1 + k));
+}
+//*****************************************************************************
+static uint8_t CODEC_gammaBits(const uint8_t run)
+{
+    uint8_t bits = 1;
+    uint8_t rest;
+
+    for(rest = run >> 1; rest; rest >>= 1)
+        bits += 2;
+
+    return(bits);
+}
+//*****************************************************************************
+static void CODEC_putBits(CODEC_encoder* encoder, const uint16_t value, uint8_t width)
+{
+    uint8_t mask;
+
+    while(width--)
+    {
+        mask = 0x80 >> (encoder->bits & 7);
+        if(value & (1u << width))
+            encoder->data[encoder->bits >> 3] |= mask;
+        else
+            encoder->data[encoder->bits >> 3] &= ~mask;
+        encoder->bits++;
+    }
+}
+//*****************************************************************************
+static void CODEC_putRice(CODEC_encoder* encoder, const uint16_t value)
+{
+    uint16_t quotient = value >> encoder->model.k;
+
+    if(quotient >= CODEC_ESCAPE)
+    {
+        CODEC_putBits(encoder, (1u << CODEC_ESCAPE) - 1, CODEC_ESCAPE);
+        CODEC_putBits(encoder, value, 16);
+    }
+    else
+    {
+        // Unario: quotient unos y un cero
+        while(quotient--)
+            CODEC_putBits(encoder, 1, 1);
+        CODEC_putBits(encoder, 0, 1);
+        CODEC_putBits(encoder, value, encoder->model.k);
+    }
+
+    CODEC_adapt(&encoder->model, value);
+}
+//*****************************************************************************
+static uint16_t CODEC_getBits(const uint8_t* data, uint16_t* position, uint8_t width)
+{
+    uint16_t value = 0;
+
+    while(width--)
+    {
+        value = (value << 1) | ((data[*position >> 3] >> (7 - (*position & 7))) & 1);
+        (*position)++;
+    }
+
+    return(value);
+}
+//*****************************************************************************
+void CODEC_initEncoder(CODEC_encoder* encoder, uint8_t* data, const uint16_t size)
+{
+    encoder->data = data;
+    encoder->size = size;
+    encoder->bits = CODEC_COUNT_BITS;       // Cabecera, se escribe al cerrar
+    encoder->previous = 0;
+    CODEC_initModel(&encoder->model);
+    encoder->count = 0;
+    encoder->run = 0;
+}
+//*****************************************************************************
+uint8_t CODEC_put(CODEC_encoder* encoder, const uint16_t sample)
+{
+    int16_t delta = (int16_t)(sample - encoder->previous);
+    uint16_t zigzag;
+    CODEC_model model;
+    uint16_t cost;
+
+    if(encoder->count == CODEC_BLOCK_SAMPLES)
+        return(STATUS_FAIL);
+
+    if(encoder->count == 0)
+    {
+        if(encoder->bits + 16 > encoder->size * 8)
+            return(STATUS_FAIL);
+        CODEC_putBits(encoder, sample, 16);
+    }
+    else if(delta == 0)
+    {
+        // La racha se paga al cerrarla; al final del bloque es gratis
+        encoder->run++;
+    }
+    else
+    {
+        // Costo exacto con el parmetro que tendr cada valor
+        zigzag = (uint16_t)(((uint16_t)delta << 1) ^ (uint16_t)(delta >> 15));
+        model = encoder->model;
+        cost = 0;
+        if(encoder->run)
+        {
+            cost = CODEC_riceBits(0, model.k) + CODEC_gammaBits(encoder->run);
+            CODEC_adapt(&model, 0);
+        }
+        cost += CODEC_riceBits(zigzag, model.k);
+        if(encoder->bits + cost > encoder->size * 8)
+            return(STATUS_FAIL);
+
+        if(encoder->run)
+        {
+            CODEC_putRice(encoder, 0);
+            // Gamma: tantos ceros como bits tiene el largo menos uno
+            CODEC_putBits(encoder, 0, CODEC_gammaBits(encoder->run) >> 1);
+            CODEC_putBits(encoder, encoder->run, (CODEC_gammaBits(encoder->run) >> 1) + 1);
+        }
+        encoder->run = 0;
+        CODEC_putRice(encoder, zigzag);
+    }
+
+    encoder->previous = sample;
+    encoder->count++;
+
+    return(STATUS_SUCCESS);
+}
+//*****************************************************************************
+uint16_t CODEC_finish(CODEC_encoder* encoder)
+{
+    uint16_t bits;
+
+    if(encoder->count == 0)
+        return(0);
+
+    // Relleno con unos: el decodificador lo lee como un unario incompleto
+    while(encoder->bits & 7)
+        CODEC_putBits(encoder, 1, 1);
+    bits = encoder->bits;
+
+    encoder->bits = 0;
+    CODEC_putBits(encoder, encoder->count - 1, CODEC_COUNT_BITS);
+    encoder->bits = bits;
+
+    return(bits >> 3);
+}
+//*****************************************************************************
+uint16_t CODEC_decode(const uint8_t* data, const uint16_t length,
+                      uint16_t* samples, const uint16_t max)
+{
+    const uint16_t end = length * 8;
+    CODEC_model model;
+    uint16_t previous;
+    uint16_t position = 0;
+    uint16_t count, total;
+    uint16_t value;
+    uint8_t quotient;
+    uint8_t bit;
+    uint8_t zeros;
+
+    if(end < CODEC_COUNT_BITS + 16 || max == 0)
+        return(0);
+
+    total = CODEC_getBits(data, &position, CODEC_COUNT_BITS) + 1;
+    if(total > max)
+        total = max;
+    previous = CODEC_getBits(data, &position, 16);
+    samples[0] = previous;
+    count = 1;
+    CODEC_initModel(&model);
+
+    while(count < total)
+    {
+        // Unario, hasta el cero o el escape
+        bit = 1;
+        for(quotient = 0; quotient < CODEC_ESCAPE && position < end; quotient++)
+            if((bit = (uint8_t)CODEC_getBits(data, &position, 1)) == 0)
+                break;
+        if(quotient == CODEC_ESCAPE)
+        {
+            if(position + 16 > end)
+                break;
+            value = CODEC_getBits(data, &position, 16);
+        }
+        else
+        {
+            if(bit || position + model.k > end)
+                break;                      // Relleno o smbolo incompleto
+            value = ((uint16_t)quotient << model.k) | CODEC_getBits(data, &position, model.k);
+        }
+        CODEC_adapt(&model, value);
+
+        if(value == 0)
+        {
+            // Racha en cdigo gamma
+            bit = 0;
+            for(zeros = 0; zeros < 8 && position < end; zeros++)
+                if((bit = (uint8_t)CODEC_getBits(data, &position, 1)) != 0)
+                    break;
+            if(!bit || position + zeros > end)
+                break;
+            for(value = (1u << zeros) | CODEC_getBits(data, &position, zeros); value && count < total; value--)
+                samples[count++] = previous;
+        }
+        else
+        {
+            previous += (uint16_t)((value >> 1) ^ -(value & 1));
+            samples[count++] = previous;
+        }
+    }
+
+    // La racha final no se escribe
+    while(count < total)
+        samples[count++] = previous;
+
+    return(count);
+}
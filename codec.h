@@ -0,0 +1,244 @@
+/**
+  * @file     codec.h
+  * @brief    Compresin sin prdida de secuencias de muestras del ADC.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// codec.h - Delta, zig-zag y cdigo de Rice adaptativo en bloques pequeos.
+//
+//*****************************************************************************
+
+#ifndef CODEC_H_
+#define CODEC_H_
+
+//*****************************************************************************
+//                              Include
+//*****************************************************************************
+#include "driverlib.h"
+
+//*****************************************************************************
+//                              Definiciones
+//*****************************************************************************
+//*****************************************************************************
+//! \details Tamao sugerido de un bloque en bytes. Cada bloque se decodifica
+//!          solo, por lo que perder uno no afecta a los dems.
+//*****************************************************************************
+#define CODEC_BLOCK_SIZE 32
+
+//*****************************************************************************
+//! \details Mximo de muestras por bloque; es el tamao del arreglo que
+//!          necesita CODEC_decode().
+//*****************************************************************************
+#define CODEC_BLOCK_SAMPLES 64
+
+//*****************************************************************************
+//! \details Bits de la cabecera del bloque: cantidad de muestras menos 1.
+//*****************************************************************************
+#define CODEC_COUNT_BITS 6
+
+//*****************************************************************************
+//! \details Unos seguidos del cdigo unario que anuncian un valor de 16 bits
+//!          sin codificar. Debe ser mayor que 7 para que el relleno con unos
+//!          del ltimo byte quede como un smbolo incompleto.
+//*****************************************************************************
+#define CODEC_ESCAPE 12
+
+//*****************************************************************************
+//! \details Valores tras los cuales la suma del parmetro adaptativo se
+//!          reduce a la mitad, para seguir cambios de la seal.
+//*****************************************************************************
+#define CODEC_RESET 16
+
+//*****************************************************************************
+//! \details Parmetro de Rice mximo.
+//*****************************************************************************
+#define CODEC_K_MAX 15
+
+//*****************************************************************************
+//! \brief Estado del parmetro adaptativo, igual en el codificador y el
+//!        decodificador.
+//*****************************************************************************
+typedef struct CODEC_model
+{
+    //! Suma de los ltimos valores codificados.
+    uint32_t sum;
+    //! Cantidad de valores en \b sum.
+    uint8_t symbols;
+    //! Parmetro de Rice: bits bajos que se escriben sin codificar.
+    uint8_t k;
+} CODEC_model;
+
+//*****************************************************************************
+//! \brief Codificador de un canal.
+//!
+//! \details El bloque comienza con la cantidad de muestras
+//!          (\b CODEC_COUNT_BITS) y la primera muestra en 16 bits. Cada
+//!          muestra siguiente se guarda como la diferencia con la anterior
+//!          (delta), llevada a un nmero sin signo con zig-zag
+//!          (0, -1, 1, -2... pasan a 0, 1, 2, 3...). Las diferencias nulas
+//!          seguidas se juntan en una racha. Cada valor se escribe en cdigo
+//!          de Rice con parmetro \b k: el valor >> \b k en unario y los
+//!          \b k bits bajos tal cual. El valor 0 es una racha, seguida de su
+//!          largo en cdigo gamma de Elias; el zig-zag de una diferencia no
+//!          nula es siempre mayor que 0. \b k se adapta como en JPEG-LS al
+//!          promedio de los ltimos valores, as 1 cuenta de ruido cuesta 2
+//!          o 3 bits y una racha en una seal quieta pocos bits. La racha que
+//!          cierra el bloque no se escribe: el decodificador completa las
+//!          muestras que indica la cabecera.
+//!          Contra 2 bytes por muestra, host/test_codec.c mide 5,4x en un EC5
+//!          con 1 cuenta de ruido, 21x en una batera casi quieta y 1,3x con
+//!          muestras aleatorias de 10 bits.
+//*****************************************************************************
+typedef struct CODEC_encoder
+{
+    //! Bloque donde se escriben los smbolos.
+    uint8_t* data;
+    //! Tamao de \b data en bytes.
+    uint16_t size;
+    //! Bits escritos, incluida la cabecera.
+    uint16_t bits;
+    //! ltima muestra.
+    uint16_t previous;
+    //! Parmetro adaptativo.
+    CODEC_model model;
+    //! Muestras en el bloque.
+    uint8_t count;
+    //! Diferencias nulas pendientes de escribir.
+    uint8_t run;
+} CODEC_encoder;
+
+//*****************************************************************************
+//                              Funciones Prototipos
+//*****************************************************************************
+//*****************************************************************************
+//! \brief Inicializa el parmetro adaptativo.
+//!
+//! \param model Estado a inicializar.
+//!
+//! \return \c void
+//*****************************************************************************
+static void CODEC_initModel(CODEC_model* model);
+
+//*****************************************************************************
+//! \brief Suma un valor codificado al parmetro adaptativo y recalcula
+//!        \b k, el menor que cumple <tt>symbols << k >= sum</tt>.
+//!
+//! \param model Estado.
+//! \param value Valor recin codificado o decodificado.
+//!
+//! \return \c void
+//*****************************************************************************
+static void CODEC_adapt(CODEC_model* model, const uint16_t value);
+
+//*****************************************************************************
+//! \brief Bits que ocupa un valor en cdigo de Rice.
+//!
+//! \param value Valor.
+//! \param k Parmetro de Rice.
+//!
+//! \return \c Cantidad de bits, incluido el escape.
+//*****************************************************************************
+static uint8_t CODEC_riceBits(const uint16_t value, const uint8_t k);
+
+//*****************************************************************************
+//! \brief Bits que ocupa el largo de una racha en cdigo gamma.
+//!
+//! \param run Largo, 1 a \b CODEC_BLOCK_SAMPLES - 1.
+//!
+//! \return \c Cantidad de bits.
+//*****************************************************************************
+static uint8_t CODEC_gammaBits(const uint8_t run);
+
+//*****************************************************************************
+//! \brief Escribe bits al final del bloque, el ms significativo primero.
+//!
+//! \param encoder Codificador.
+//! \param value Bits a escribir, alineados a la derecha.
+//! \param width Cantidad de bits, hasta 16.
+//!
+//! \return \c void
+//*****************************************************************************
+static void CODEC_putBits(CODEC_encoder* encoder, const uint16_t value, uint8_t width);
+
+//*****************************************************************************
+//! \brief Escribe un valor en cdigo de Rice y adapta el parmetro.
+//!
+//! \param encoder Codificador, debe haber lugar para el valor.
+//! \param value Valor.
+//!
+//! \return \c void
+//*****************************************************************************
+static void CODEC_putRice(CODEC_encoder* encoder, const uint16_t value);
+
+//*****************************************************************************
+//! \brief Lee bits de un bloque, el ms significativo primero.
+//!
+//! \param data Bloque.
+//! \param position Posicin en bits, avanza \p width.
+//! \param width Cantidad de bits, hasta 16.
+//!
+//! \return \c Bits ledos, alineados a la derecha.
+//*****************************************************************************
+static uint16_t CODEC_getBits(const uint8_t* data, uint16_t* position, uint8_t width);
+
+//*****************************************************************************
+//! \brief Comienza un bloque nuevo.
+//!
+//! \param encoder Codificador.
+//! \param data Bloque donde se escriben los smbolos.
+//! \param size Tamao de \p data en bytes, normalmente
+//!             \b CODEC_BLOCK_SIZE.
+//!
+//! \return \c void
+//*****************************************************************************
+void CODEC_initEncoder(CODEC_encoder* encoder, uint8_t* data, const uint16_t size);
+
+//*****************************************************************************
+//! \brief Agrega una muestra al bloque.
+//!
+//! \details \b Descripcin \n
+//!          Calcula el costo exacto de la muestra (incluida la racha de
+//!          diferencias nulas que deba cerrarse) y solo la agrega si entra.
+//!          Una diferencia nula siempre entra: alarga la racha, que se paga
+//!          al cerrarla o es gratis si termina el bloque.
+//!          Si el bloque est lleno se debe cerrar con CODEC_finish(),
+//!          comenzar otro y volver a agregar la muestra.
+//!
+//! \param encoder Codificador.
+//! \param sample Muestra.
+//!
+//! \return \c STATUS_SUCCESS si se agreg o \c STATUS_FAIL si el bloque
+//!         est lleno.
+//*****************************************************************************
+uint8_t CODEC_put(CODEC_encoder* encoder, const uint16_t sample);
+
+//*****************************************************************************
+//! \brief Cierra el bloque: escribe la cabecera y completa el ltimo byte
+//!        con unos.
+//!
+//! \param encoder Codificador.
+//!
+//! \return \c Bytes del bloque, 0 si no tiene muestras.
+//*****************************************************************************
+uint16_t CODEC_finish(CODEC_encoder* encoder);
+
+//*****************************************************************************
+//! \brief Decodifica un bloque.
+//!
+//! \param data Bloque.
+//! \param length Bytes del bloque, el valor devuelto por CODEC_finish().
+//! \param samples Arreglo donde se guardan las muestras.
+//! \param max Tamao de \p samples, \b CODEC_BLOCK_SAMPLES alcanza para
+//!            cualquier bloque.
+//!
+//! \return \c Cantidad de muestras decodificadas, la de la cabecera o
+//!         \p max si es menor. Un smbolo incompleto termina el bloque con
+//!         la ltima muestra repetida.
+//*****************************************************************************
+uint16_t CODEC_decode(const uint8_t* data, const uint16_t length,
+                      uint16_t* samples, const uint16_t max);
+
+#endif /* CODEC_H_ */
@@ -0,0 +1,106 @@
+/*
+ * convert.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Matas Lpez - Jess Lpez
+ */
+//*****************************************************************************
+//
+// convert.c - Conversin en punto fijo de las mediciones del ADC.
+//
+//*****************************************************************************
+
+#include "convert.h"
+//*****************************************************************************
+uint16_t CONV_supplyMillivolts(const uint16_t vrefRaw)
+{
+    if(vrefRaw == 0)
+        return(0);
+
+    return((uint16_t)((CONV_SUPPLY_NUM + (vrefRaw >> 1)) / vrefRaw));
+}
+//*****************************************************************************
+uint16_t CONV_sensorMillivolts(const uint16_t raw, const uint16_t supplyMv)
+{
+    uint32_t product = (uint32_t)raw * supplyMv;        // < 2^22
+
+    return((uint16_t)((product * CONV_SENSOR_GAIN_Q20 + (1UL << 19)) >> 20));
+}
+//*****************************************************************************
+uint16_t CONV_batteryMillivolts(const uint16_t raw, const uint16_t supplyMv)
+{
+    uint32_t product = (uint32_t)raw * supplyMv;        // < 2^22
+    uint32_t inputQ4 = (product * CONV_SENSOR_GAIN_Q20) >> 16;
+
+    return((uint16_t)(((inputQ4 * CONV_BAT_RATIO_Q12 + (1UL << 15)) >> 16)
+                      + CONV_BAT_DROP_MV));
+}
+//*****************************************************************************
+int16_t CONV_mpx5700Kpa(const uint16_t raw)
+{
+    int32_t delta = ((int32_t)raw << 8) - CONV_MPX_OFFSET_Q8;  // Q8
+
+    return((int16_t)((delta * CONV_MPX_GAIN_Q12 + (1L << 19)) >> 20));
+}
+//*****************************************************************************
+void CONV_scaleBlock(const uint16_t* raw, int16_t* out, const uint16_t count,
+                     const int16_t gain, const int16_t offset)
+{
+    uint16_t i;
+
+    MPY32_disableFractionalMode();
+    MPY32_enableSaturationMode();
+
+    for(i = 0; i < count; i++)
+    {
+        HWREG16(MPY32_BASE + OFS_RES0) = 0;                 // Preload offset << 16
+        HWREG16(MPY32_BASE + OFS_RES1) = offset;
+        HWREG16(MPY32_BASE + OFS_MPY + MPY32_MULTIPLYACCUMULATE_SIGNED) = raw[i] << CONV_SCALE_SHIFT;
+        HWREG16(MPY32_BASE + OFS_OP2) = gain;               // Starts MACS
+        out[i] = HWREG16(MPY32_BASE + OFS_RES1);            // Saturated RESHI
+    }
+
+    MPY32_disableSaturationMode();
+}
+//*****************************************************************************
+void CONV_scaleBlockSoft(const uint16_t* raw, int16_t* out,
+                         const uint16_t count, const int16_t gain,
+                         const int16_t offset)
+{
+    int32_t value;
+    uint16_t i;
+
+    for(i = 0; i < count; i++)
+    {
+        value = (CONV_MULTIPLY((int32_t)(raw[i] << CONV_SCALE_SHIFT), (int32_t)gain) >> 16) + offset;
+
+        if(value > INT16_MAX)
+            value = INT16_MAX;
+        else if(value < INT16_MIN)
+            value = INT16_MIN;
+        out[i] = (int16_t)value;
+    }
+}
+#ifdef CONV_BENCHMARK
+//*****************************************************************************
+void CONV_benchmarkScale(const uint16_t* raw, int16_t* out,
+                         const uint16_t count, uint16_t* hwCycles,
+                         uint16_t* swCycles)
+{
+    const int16_t gain = CONV_SCALE_GAIN(3.3 / CONV_FULL_SCALE * 1000);
+    uint16_t start;
+
+    TA1CTL = TACLR;
+    TA1CTL = TASSEL_2 + MC_2;               // SMCLK, continuous mode
+
+    start = TA1R;
+    CONV_scaleBlock(raw, out, count, gain, 0);
+    *hwCycles = TA1R - start;
+
+    start = TA1R;
+    CONV_scaleBlockSoft(raw, out, count, gain, 0);
+    *swCycles = TA1R - start;
+
+    TA1CTL = MC_0;
+}
+#endif
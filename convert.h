@@ -0,0 +1,273 @@
+/**
+  * @file     convert.h
+  * @brief    Conversin de las mediciones del ADC a unidades de ingeniera
+  *           en aritmtica entera.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// convert.h - Conversin en punto fijo de las mediciones del ADC.
+//
+//*****************************************************************************
+
+#ifndef CONVERT_H_
+#define CONVERT_H_
+
+//*****************************************************************************
+//                              Include
+//*****************************************************************************
+#include "driverlib.h"
+
+//*****************************************************************************
+//                              Definiciones
+//*****************************************************************************
+//*****************************************************************************
+//! @name Parmetros del circuito:
+//! \brief Valores del hardware a partir de los cuales se calculan las
+//!        constantes de conversin.
+//! @{
+//*****************************************************************************
+//*****************************************************************************
+//! \details Valor mximo de la conversin de 10 bits.
+//*****************************************************************************
+#define CONV_FULL_SCALE         1023
+
+//*****************************************************************************
+//! \details Tensin de la referencia interna en milivoltios.
+//*****************************************************************************
+#define CONV_VREF_MV            1500
+
+//*****************************************************************************
+//! \details Resistencias del divisor de la batera en ohms.
+//*****************************************************************************
+#define CONV_BAT_R_HIGH         8200
+#define CONV_BAT_R_LOW          2200
+
+//*****************************************************************************
+//! \details Cada de tensin en los transistores de la llave en milivoltios.
+//*****************************************************************************
+#define CONV_BAT_DROP_MV        900
+
+//*****************************************************************************
+//! \details Conversin del MPX5700 a 0 kPa y a fondo de escala. El sensor es
+//!          de 5V y se conecta a travs de un divisor resistivo, de ah
+//!          salen estos valores.
+//*****************************************************************************
+#define CONV_MPX_OFFSET         41.37
+#define CONV_MPX_FULL           972.28
+
+//*****************************************************************************
+//! \details Presin a fondo de escala del MPX5700 en kPa.
+//*****************************************************************************
+#define CONV_MPX_FULL_KPA       700
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! @name Constantes en punto fijo:
+//! \brief Se calculan en tiempo de compilacin, por lo que no se utiliza la
+//!        librera de punto flotante en tiempo de ejecucin.
+//! @{
+//*****************************************************************************
+//*****************************************************************************
+//! \details Numerador de la tensin de alimentacin: Vref * 1023.
+//*****************************************************************************
+#define CONV_SUPPLY_NUM         ((uint32_t)CONV_VREF_MV * CONV_FULL_SCALE)
+
+//*****************************************************************************
+//! \details 1 / 1023 en formato Q20.
+//*****************************************************************************
+#define CONV_SENSOR_GAIN_Q20    ((uint32_t)(1048576.0 / CONV_FULL_SCALE + 0.5))
+
+//*****************************************************************************
+//! \details Relacin del divisor de la batera en formato Q12.
+//*****************************************************************************
+#define CONV_BAT_RATIO_Q12      ((uint32_t)((4096.0 * (CONV_BAT_R_HIGH + CONV_BAT_R_LOW)) / \
+                                            CONV_BAT_R_LOW + 0.5))
+
+//*****************************************************************************
+//! \details Desplazamiento del MPX5700 en formato Q8.
+//*****************************************************************************
+#define CONV_MPX_OFFSET_Q8      ((int32_t)(CONV_MPX_OFFSET * 256 + 0.5))
+
+//*****************************************************************************
+//! \details Ganancia del MPX5700 en kPa por cuenta, en formato Q12.
+//*****************************************************************************
+#define CONV_MPX_GAIN_Q12       ((int32_t)((4096.0 * CONV_MPX_FULL_KPA) / \
+                                           (CONV_MPX_FULL - CONV_MPX_OFFSET) + 0.5))
+
+//*****************************************************************************
+//! \details Desplazamiento aplicado a las conversiones en CONV_scaleBlock()
+//!          para aprovechar los 16 bits del operando con signo. Con 5 bits
+//!          una conversin de 10 bits ocupa hasta 32736 y la ganancia queda
+//!          en formato Q11.
+//*****************************************************************************
+#define CONV_SCALE_SHIFT        5
+
+//*****************************************************************************
+//! \details Convierte una ganancia real al formato Q11 de CONV_scaleBlock().
+//*****************************************************************************
+#define CONV_SCALE_GAIN(x)      ((int16_t)((x) * (1 << (16 - CONV_SCALE_SHIFT)) + 0.5))
+
+//*****************************************************************************
+//! \details Producto de 32 bits de CONV_scaleBlockSoft(), que el compilador
+//!          resuelve con su rutina de multiplicacin por software. La
+//!          compilacin en la PC lo reemplaza (host/msp430.h) para cobrar los
+//!          ciclos de esa rutina.
+//*****************************************************************************
+#ifndef CONV_MULTIPLY
+#define CONV_MULTIPLY(a, b)     ((a) * (b))
+#endif
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//                              Funciones Prototipos
+//*****************************************************************************
+//*****************************************************************************
+//! \brief Calcula la tensin de alimentacin.
+//!
+//! \details \b Descripcin \n
+//!          Equivale a <tt>(1.5 * 1023) / vrefRaw</tt> pero en milivoltios y
+//!          con una nica divisin entera redondeada.
+//!
+//! \param vrefRaw Conversin de la referencia interna (ADC_getVref()).
+//!
+//! \return \c La tensin de alimentacin en milivoltios.
+//*****************************************************************************
+uint16_t CONV_supplyMillivolts(const uint16_t vrefRaw);
+
+//*****************************************************************************
+//! \brief Calcula la tensin en la entrada del ADC.
+//!
+//! \details \b Descripcin \n
+//!          Equivale a <tt>(raw * vSup) / 1023</tt>. La divisin se reemplaza
+//!          por una multiplicacin por \b CONV_SENSOR_GAIN_Q20.
+//!
+//! \param raw Conversin en crudo.
+//! \param supplyMv Tensin de alimentacin en milivoltios (hasta 3.6V).
+//!
+//! \return \c La tensin en milivoltios.
+//*****************************************************************************
+uint16_t CONV_sensorMillivolts(const uint16_t raw, const uint16_t supplyMv);
+
+//*****************************************************************************
+//! \brief Calcula la tensin de la batera.
+//!
+//! \details \b Descripcin \n
+//!          Escala la tensin en la entrada por la relacin del divisor
+//!          resistivo (\b CONV_BAT_RATIO_Q12) y suma la cada en los
+//!          transistores \b CONV_BAT_DROP_MV.
+//!
+//! \param raw Conversin en crudo del divisor de la batera.
+//! \param supplyMv Tensin de alimentacin en milivoltios.
+//!
+//! \return \c La tensin de la batera en milivoltios.
+//*****************************************************************************
+uint16_t CONV_batteryMillivolts(const uint16_t raw, const uint16_t supplyMv);
+
+//*****************************************************************************
+//! \brief Calcula la presin medida por el MPX5700.
+//!
+//! \details \b Descripcin \n
+//!          Equivale a <tt>((raw - 41.37) / (972.28 - 41.37)) * 700</tt>
+//!          redondeado al kPa ms cercano.
+//!
+//! \param raw Conversin en crudo del sensor.
+//!
+//! \return \c La presin en kPa. Puede ser negativa por debajo del offset.
+//*****************************************************************************
+int16_t CONV_mpx5700Kpa(const uint16_t raw);
+
+//*****************************************************************************
+//! \brief Escala un bloque de conversiones con el multiplicador por hardware.
+//!
+//! \details \b Descripcin \n
+//!          Calcula <tt>out[i] = ((raw[i] * gain) >> 11) + offset</tt>
+//!          saturado a 16 bits con signo, utilizando el multiplicador
+//!          \b MPY32 en modo multiplicacin-acumulacin con signo (\b MACS).
+//!          Para cada muestra se precarga \p offset en la parte alta del
+//!          resultado y el hardware suma el producto; con el modo de
+//!          saturacin habilitado \b RESHI queda limitado al rango de
+//!          \c int16_t sin comparaciones por software. El proyecto se
+//!          compila sin multiplicador por hardware, por lo que sin esta
+//!          funcin cada producto llama a la rutina de multiplicacin por
+//!          software del compilador (ver CONV_scaleBlockSoft()).
+//!
+//! \param raw Conversiones de 10 bits.
+//! \param out Arreglo donde se guardan los valores escalados.
+//! \param count Cantidad de conversiones.
+//! \param gain Ganancia en formato Q11, ver \b CONV_SCALE_GAIN().
+//! \param offset Desplazamiento sumado luego de escalar.
+//!
+//! \return \c void
+//!
+//! \attention Modifica los registros del \b MPY32 y deja deshabilitado el
+//!            modo de saturacin al finalizar. No debe utilizarse el
+//!            multiplicador desde una interrupcin mientras se ejecuta.
+//*****************************************************************************
+void CONV_scaleBlock(const uint16_t* raw, int16_t* out, const uint16_t count,
+                     const int16_t gain, const int16_t offset);
+
+//*****************************************************************************
+//! \brief Escala un bloque de conversiones con la multiplicacin del
+//!        compilador.
+//!
+//! \details \b Descripcin \n
+//!          Mismo resultado que CONV_scaleBlock() calculado en C. Se mantiene
+//!          como referencia para comparar ciclos y en aplicaciones donde el
+//!          \b MPY32 est ocupado.
+//!
+//! \param raw Conversiones de 10 bits.
+//! \param out Arreglo donde se guardan los valores escalados.
+//! \param count Cantidad de conversiones.
+//! \param gain Ganancia en formato Q11, ver \b CONV_SCALE_GAIN().
+//! \param offset Desplazamiento sumado luego de escalar.
+//!
+//! \return \c void
+//*****************************************************************************
+void CONV_scaleBlockSoft(const uint16_t* raw, int16_t* out,
+                         const uint16_t count, const int16_t gain,
+                         const int16_t offset);
+
+#ifdef CONV_BENCHMARK
+//*****************************************************************************
+//! \brief Mide los ciclos de CPU de CONV_scaleBlock() y
+//!        CONV_scaleBlockSoft() sobre el mismo bloque.
+//!
+//! \details \b Descripcin \n
+//!          Cuenta con el <b>Timer1_A3</b> en modo continuo alimentado por
+//!          \b SMCLK (igual a \b MCLK), por lo que cada cuenta es un ciclo de
+//!          CPU. Solo se compila definiendo \b CONV_BENCHMARK; la
+//!          compilacin en la PC lo define y host/test_convert.c lo ejecuta.
+//!
+//!          En el simulador, con bloques de 64 muestras y la ganancia de
+//!          3.3 V, CONV_scaleBlock() cuesta 19.8 ciclos por muestra en
+//!          accesos al \b MPY32 (cuatro escrituras y una lectura) y
+//!          CONV_scaleBlockSoft() 229 ciclos en la rutina de multiplicacin
+//!          del compilador, que recorre la ganancia bit a bit (13 vueltas
+//!          para esa ganancia). El modelo no cuenta las dems instrucciones
+//!          del lazo.
+//!
+//! \param raw Conversiones de 10 bits.
+//! \param out Arreglo de trabajo de \p count elementos.
+//! \param count Cantidad de conversiones.
+//! \param hwCycles Puntero donde se guardan los ciclos con \b MPY32.
+//! \param swCycles Puntero donde se guardan los ciclos por software.
+//!
+//! \return \c void
+//!
+//! \attention Utiliza el <b>Timer1_A3</b>.
+//*****************************************************************************
+void CONV_benchmarkScale(const uint16_t* raw, int16_t* out,
+                         const uint16_t count, uint16_t* hwCycles,
+                         uint16_t* swCycles);
+#endif
+
+#endif /* CONVERT_H_ */
@@ -11,40 +11,81 @@
 //*****************************************************************************
 
 #include "delay.h"
+
+//*****************************************************************************
+//                              Variables
+//*****************************************************************************
+#if defined(DELAY_MCLK_HZ) && defined(DELAY_ACLK_HZ)
+// Relojes conocidos en compilacin: los factores son constantes
+#define delayAclkHz      DELAY_ACLK_HZ
+#define delayCyclesPerUs DELAY_FACTOR(DELAY_MCLK_HZ, 65536UL, 1000000UL)
+#define delayTicksPerUs  DELAY_FACTOR(DELAY_ACLK_HZ, 65536UL, 1000000UL)
+#define delayTicksPerMs  DELAY_FACTOR(DELAY_ACLK_HZ, 256UL, 1000UL)
+#else
+static uint32_t delayAclkHz;
+static uint32_t delayCyclesPerUs;       // Ciclos de MCLK por us, 16.16
+static uint32_t delayTicksPerUs;        // Cuentas de ACLK por us, 16.16
+static uint32_t delayTicksPerMs;        // Cuentas de ACLK por ms, 24.8
+#endif
+static uint16_t delaySleepUs;           // Espera mnima en LPM3
+static uint8_t delayCalibrated;         // delay_init() ya se ejecut
+
 /*****************************************************************************/
-void delay_us(const uint16_t us)
+static void delay_spin(uint16_t cycles)
 {
-    TA0CTL = TACLR;
-    TA0CCR0 = us;
-    TA0CCTL0 |= CCIE;
-    TA0EX0 = TAIDEX_3;
-    TA0CTL = TASSEL_2 + ID_1 + MC_1;
-    __bis_SR_register(LPM3_bits + GIE);
+    for(; cycles >= DELAY_SPIN_CYCLES; cycles -= DELAY_SPIN_CYCLES)
+        __delay_cycles(DELAY_SPIN_CYCLES - DELAY_LOOP_CYCLES);
 }
 /*****************************************************************************/
-void delay_ms(const uint16_t ms)
+void delay_init(void)
 {
-    TA0CTL = TACLR;
-    TA0CCR0 = ms;
-    TA0CCTL0 |= CCIE;
-    TA0EX0 = TAIDEX_3;
-    TA0CTL = TASSEL_1 + ID_3 + MC_1;
-    __bis_SR_register(LPM3_bits + GIE);
-}
-//***************************************************************************************************************
-// Timer A0 interrupt service routine --> Timer1_A3 CC0
-#if defined(__TI_COMPILER_VERSION__) || defined(__IAR_SYSTEMS_ICC__)
-#pragma vector = TIMER0_A0_VECTOR
-__interrupt void TIMER0_A0_ISR(void)
-#elif defined(__GNUC__)
-void __attribute__ ((interrupt(TIMER0_A0_VECTOR))) Timer_A (void)
-#else
-#error Compiler not supported!
+    TIMER_handle timer = {0};
+    uint32_t start;
+
+#if !(defined(DELAY_MCLK_HZ) && defined(DELAY_ACLK_HZ))
+    uint32_t mclk = CS_getMCLK();
+
+    delayAclkHz = CS_getACLK();
+    delayCyclesPerUs = DELAY_FACTOR(mclk, 65536UL, 1000000UL);
+    delayTicksPerUs = DELAY_FACTOR(delayAclkHz, 65536UL, 1000000UL);
+    delayTicksPerMs = DELAY_FACTOR(delayAclkHz, 256UL, 1000UL);
 #endif
+
+    // Espera ms corta posible en LPM3
+    start = TIMER_getTime();
+    TIMER_start(&timer, 0, 0, 0);
+    TIMER_wait(&timer);
+    delaySleepUs = (uint16_t)(((TIMER_getTime() - start) * 1000000UL + delayAclkHz - 1) / delayAclkHz);
+    delayCalibrated = 1;
+}
+/*****************************************************************************/
+void delay_us(const uint16_t us)
 {
-    TA0CTL = MC_0;
-    TA0CCR0 = 0;
-    TA0CTL &= ~TAIFG;
-    TA0EX0 = TAIDEX_0;
-    __bic_SR_register_on_exit(LPM3_bits + GIE);
+    TIMER_handle timer = {0};
+
+    if(!delayCalibrated)
+        delay_init();
+
+    if(us < delaySleepUs)
+    {
+        delay_spin((uint16_t)((us * delayCyclesPerUs) >> 16));
+        return;
+    }
+
+    TIMER_start(&timer, (us * delayTicksPerUs + 0xFFFF) >> 16, 0, 0);
+    TIMER_wait(&timer);
+}
+/*****************************************************************************/
+void delay_ms(const uint16_t ms)
+{
+    TIMER_handle timer = {0};
+
+    if(!delayCalibrated)
+        delay_init();
+
+    if(!ms)
+        return;
+
+    TIMER_start(&timer, (ms * delayTicksPerMs + 0xFF) >> 8, 0, 0);
+    TIMER_wait(&timer);
 }
@@ -18,10 +18,30 @@
 //                              Include
 //*****************************************************************************
 #include "driverlib.h"
+#include "timer.h"
 
 //*****************************************************************************
 //                              Definiciones
 //*****************************************************************************
+//*****************************************************************************
+//! @name Relojes conocidos en compilacin:
+//! \brief Si el proyecto define \b DELAY_MCLK_HZ y \b DELAY_ACLK_HZ (por
+//!        ejemplo -DDELAY_MCLK_HZ=8000000 -DDELAY_ACLK_HZ=32768) los factores
+//!        de conversin son constantes y no se consulta \b CS. Si no, se
+//!        obtienen con CS_getMCLK() y CS_getACLK() en delay_init().
+//! @{
+//*****************************************************************************
+//*****************************************************************************
+//! \details Convierte una frecuencia a ciclos por unidad en punto fijo,
+//!          redondeando hacia arriba: \p hz * \p scale / \p unit.
+//*****************************************************************************
+#define DELAY_FACTOR(hz, scale, unit) \
+    ((uint32_t)(((uint64_t)(hz) * (scale) + (unit) - 1) / (unit)))
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
 //*****************************************************************************
 //! @name Configuracin delays:
 //! \brief Defines para configurar la velocidad de la CPU. Esta forma es mas
@@ -32,25 +52,43 @@
 //*****************************************************************************
 //! \details Depende de la velocidad que tenga la CPU.
 //*****************************************************************************
+#ifdef DELAY_MCLK_HZ
+#define CYCLES_PER_US (DELAY_MCLK_HZ / 1000000L)
+#else
 #define CYCLES_PER_US 8L // depends on the CPU speed
+#endif
 
 //*****************************************************************************
 //! \details Depende del valor asignado a CYCLES_PER US multiplicado por 1000
 //!          para que este en terminos de milisegundos.
 //*****************************************************************************
+#ifdef DELAY_MCLK_HZ
+#define CYCLES_PER_MS (DELAY_MCLK_HZ / 1000L)
+#else
 #define CYCLES_PER_MS (CYCLES_PER_US * 1000L)
+#endif
 
 //*****************************************************************************
 //! \details Mediante esta constante se ingresa el valor del delay necesario
 //!          en x y se obtiene un delay de tiempo en terminos de micro segundos.
 //*****************************************************************************
-#define DELAY_US(x) __delay_cycles((x * CYCLES_PER_US))
+#define DELAY_US(x) __delay_cycles(((x) * CYCLES_PER_US))
 
 //*****************************************************************************
 //! \details Mediante esta constante se ingresa el valor del delay necesario
 //!          en x y se obtiene un delay de tiempo en terminos de mili segundos.
 //*****************************************************************************
-#define DELAY_MS(x) __delay_cycles((x * CYCLES_PER_MS))
+#define DELAY_MS(x) __delay_cycles(((x) * CYCLES_PER_MS))
+
+//*****************************************************************************
+//! \details Ciclos de MCLK por vuelta de la espera activa de delay_us().
+//*****************************************************************************
+#define DELAY_SPIN_CYCLES 8
+
+//*****************************************************************************
+//! \details Ciclos de la resta, comparacin y salto de cada vuelta.
+//*****************************************************************************
+#define DELAY_LOOP_CYCLES 4
 
 //*****************************************************************************
 //! @}
@@ -59,32 +97,52 @@
 //*****************************************************************************
 //                              Functiones Prototipos
 //*****************************************************************************
+//*****************************************************************************
+//! \brief Espera activa de un nmero de ciclos de \b MCLK calculado en
+//!        tiempo de ejecucin.
+//!
+//! \param cycles Ciclos de \b MCLK, resolucin \b DELAY_SPIN_CYCLES.
+//!
+//! \return \c void.
+//*****************************************************************************
+static void delay_spin(uint16_t cycles);
+
+//*****************************************************************************
+//! \brief Calibra los retardos para los relojes actuales.
+//!
+//! \details \b Descripcin \n
+//!          Sin \b DELAY_MCLK_HZ y \b DELAY_ACLK_HZ obtiene las frecuencias
+//!          con CS_getMCLK() y CS_getACLK() y calcula los factores de
+//!          conversin, as cada retardo solo multiplica. Luego mide con el
+//!          <b>Timer0_A3</b> la espera ms corta posible en \b LPM3: entrada,
+//!          vencimiento mnimo del servicio y salida de la interrupcin. Las
+//!          esperas ms cortas que esa medicin se hacen con delay_spin().
+//!
+//! \note Se llama sola en el primer retardo. Debe volver a llamarse si se
+//!       cambia la configuracin de \b CS.
+//!
+//! \return \c void.
+//*****************************************************************************
+void delay_init(void);
+
 //*****************************************************************************
 //! \brief Retardo de tiempo en microsegundos.
 //!
 //! \details \b Descripcin \n
-//!          Primero se setea el bit \b TACLR en el registro \b TA0CTL que
-//!          resetea el \b TAR. Luego se carga el \b TA0CCR0 con el valor
-//!          hasta donde se desea que cuente. Posteriormemte se habilitan las
-//!          interrupciones del Capture/Compare 0, luego se divide la seal
-//!          de reloj por 4 y por ltimo se configura el <b>Timer A</b>
-//!          seleccionando como fuente de reloj \b SMCLK dividiendola por
-//!          2 mediante los bits \b ID_1 y en modo up que contara hasta
-//!          llegar al valor seteado en elregistro \b TA0CCR0. Por ltimo,
-//!          entra al modo bajo consumo \b LMP3.
+//!          Si la espera es menor que la espera mnima en \b LPM3 medida por
+//!          delay_init() se hace activa con \b MCLK. Si no, inicia un
+//!          temporizador de un disparo del servicio de timer.h y espera en
+//!          \b LPM3 a que venza. Los dems temporizadores del servicio siguen
+//!          corriendo durante la espera.
 //!
-//! \note Se debe configurar el timer de este modo para evitar un comportamiento
-//!       impredecible (Esto se indica en el datasheet del dispositivo).
-//!       Tambien puede observarse que, previo a la configuracin del timer, se
-//!       deshabilita la interrupcin que es utilizada por el RF para que
-//!       no interrumpa y permita que finalice el conteo del timer.
+//! \note En \b LPM3 la resolucin es la de \b ACLK (30,5 us con 32768 Hz);
+//!       el retardo se redondea hacia arriba.
 //!
 //! \param us Valor de tiempo en microsegundos que es requerido por el usuario.
 //!
 //! \return \c void.
 //!
-//! \attention Modifica los bits de los registros \b TA1CTL, \b TA1CCTL0,
-//!            \b TA0CCR0 y \SR.
+//! \attention Al retornar \b GIE queda como estaba.
 //*****************************************************************************
 void delay_us(const uint16_t);
 
@@ -92,28 +150,14 @@ void delay_us(const uint16_t);
 //! \brief Retardo de tiempo en milisegundos.
 //!
 //! \details \b Descripcin \n
-//!          Primero se setea el bit \b TACLR en el registro \b TA0CTL que
-//!          resetea el \b TAR. Luego se carga el \b TA0CCR0 con el valor
-//!          hasta donde se desea que cuente. Posteriormemte se habilitan las
-//!          interrupciones del Capture/Compare 0, luego se divide la seal
-//!          de reloj por 4 y por ltimo se configura el <b>Timer A</b>
-//!          seleccionando como fuente de reloj \b ACLK dividiendola por
-//!          8 mediante los bits \b ID_3 y en modo up que contara hasta
-//!          llegar al valor seteado en elregistro \b TA0CCR0. Por ltimo,
-//!          entra al modo bajo consumo \b LMP3.
+//!          Igual que delay_us() con el tiempo en milisegundos. Siempre espera
+//!          en \b LPM3.
 //!
-//! \note Se debe configurar el timer de este modo para evitar un comportamiento
-//!       impredecible (Esto se indica en el datasheet del dispositivo).
-//!       Tambien puede observarse que, previo a la configuracin del timer, se
-//!       deshabilita la interrupcin que es utilizada por el RF para que
-//!       no interrumpa y permita que finalice el conteo del timer.
-//!
-//! \param us Valor de tiempo en microsegundos que es requerido por el usuario.
+//! \param ms Valor de tiempo en milisegundos que es requerido por el usuario.
 //!
 //! \return \c void.
 //!
-//! \attention Modifica los bits de los registros \b TA1CTL, \b TA1CCTL0,
-//!            \b TA0CCR0 y \SR.
+//! \attention Al retornar \b GIE queda como estaba.
 //*****************************************************************************
 void delay_ms(const uint16_t);
 
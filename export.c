@@ -0,0 +1,350 @@
+/*
+ * export.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Matas Lpez - Jess Lpez
+ */
+//*****************************************************************************
+//
+// export.c - Salida de mediciones por UART en tramas binarias.
+//
+//*****************************************************************************
+
+#include "export.h"
+
+//*****************************************************************************
+//                              Variables
+//*****************************************************************************
+static uint8_t          exportData[EXPORT_TX_SIZE];
+static RINGBUF_bytes    exportTx;           // Productor: main, consumidor: ISR
+static uint16_t         exportDrops;        // Tramas descartadas
+static volatile uint8_t exportWake;         // EXPORT_sleep() espera en LPM0
+static uint8_t          exportRingFrame;    // La ISR est en medio de una trama del buffer
+
+// Volcado del registro, solo lo avanza la ISR
+static volatile uint8_t  exportDumping;
+static volatile uint16_t exportDumpSequence;    // Prximo registro
+static const LOG_record* exportDumpRecord;      // Registro en curso, 0 entre tramas
+static uint16_t          exportDumpCrc;
+static uint8_t           exportDumpNext;        // Prximo byte antes de COBS
+static uint8_t           exportDumpRun;         // Bytes que faltan del bloque COBS
+static uint8_t           exportDumpLast;        // El bloque en curso es el ltimo
+
+// Tabla de UCBRSx: parte fraccionaria de N en 1/10000 y valor
+static const uint16_t exportFraction[] =
+{
+       0,  529,  715,  835, 1001, 1252, 1430, 1670, 2147, 2224, 2503, 3000,
+    3335, 3575, 3753, 4003, 4286, 4378, 5002, 5715, 6003, 6254, 6432, 6667,
+    7001, 7147, 7503, 7861, 8004, 8333, 8464, 8572, 8751, 9004, 9170, 9288
+};
+static const uint8_t exportUCBRS[] =
+{
+    0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x11, 0x21, 0x22, 0x44, 0x25,
+    0x49, 0x4A, 0x52, 0x92, 0x53, 0x55, 0xAA, 0x6B, 0xAD, 0xB5, 0xB6, 0xD6,
+    0xB7, 0xBB, 0xDD, 0xED, 0xEE, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE
+};
+
+//*****************************************************************************
+static void EXPORT_setBaud(const uint32_t clock, const uint32_t baud,
+                           EUSCI_A_UART_initParam* param)
+{
+    uint32_t divider = clock / baud;
+    uint16_t fraction = (uint16_t)(((clock % baud) * 100) / (baud / 100));
+    uint8_t i;
+
+    if(divider > 16)
+    {
+        param->clockPrescalar = (uint16_t)(divider / 16);
+        param->firstModReg = (uint8_t)(divider % 16);
+        param->overSampling = EUSCI_A_UART_OVERSAMPLING_BAUDRATE_GENERATION;
+    }
+    else
+    {
+        param->clockPrescalar = (uint16_t)divider;
+        param->firstModReg = 0;
+        param->overSampling = EUSCI_A_UART_LOW_FREQUENCY_BAUDRATE_GENERATION;
+    }
+
+    for(i = sizeof(exportUCBRS) - 1; exportFraction[i] > fraction; i--);
+    param->secondModReg = exportUCBRS[i];
+}
+//*****************************************************************************
+static inline uint8_t EXPORT_dumpPayload(const uint8_t position)
+{
+    if(position == 0)
+        return(EXPORT_RECORD);
+    if(position <= sizeof(LOG_record))
+        return(((const uint8_t*)exportDumpRecord)[position - 1]);
+    if(position == sizeof(LOG_record) + 1)
+        return((uint8_t)exportDumpCrc);
+
+    return((uint8_t)(exportDumpCrc >> 8));
+}
+//*****************************************************************************
+static const LOG_record* EXPORT_dumpNext(void)
+{
+    const LOG_record* record = 0;
+    const uint16_t* word;
+    uint16_t first = LOG_firstSequence();
+    uint16_t saved;
+    uint8_t w;
+
+    while(exportDumping && !record)
+    {
+        // Pisado mientras se esperaba: se sigue por el ms antiguo
+        if((int16_t)(exportDumpSequence - first) < 0)
+            exportDumpSequence = first;
+        if((uint16_t)(exportDumpSequence - first) >= LOG_count())
+            exportDumping = 0;              // Al da
+        else if(!(record = LOG_find(exportDumpSequence)))
+            exportDumpSequence++;           // Sin marca de commit
+    }
+
+    if(record)
+    {
+        saved = CRC_getResult(CRC_BASE);
+        CRC_setSeed(CRC_BASE, EXPORT_CRC_SEED);
+        CRC_set8BitData(CRC_BASE, EXPORT_RECORD);
+        for(word = (const uint16_t*)record, w = 0; w < LOG_RECORD_WORDS; w++)
+            CRC_set16BitData(CRC_BASE, word[w]);
+        exportDumpCrc = CRC_getResult(CRC_BASE);
+        CRC_setSeed(CRC_BASE, saved);
+    }
+
+    return(record);
+}
+//*****************************************************************************
+static uint8_t EXPORT_dumpByte(uint8_t* byte)
+{
+    uint8_t end;
+
+    if(!exportDumpRecord)
+    {
+        if(!(exportDumpRecord = EXPORT_dumpNext()))
+            return(0);
+        exportDumpNext = 0;
+        exportDumpRun = 0;
+        exportDumpLast = 0;
+    }
+
+    if(exportDumpRun == 0)
+    {
+        if(exportDumpLast)
+        {
+            // Delimitador, la trama termin
+            *byte = 0x00;
+            exportDumpRecord = 0;
+            exportDumpSequence++;
+            return(1);
+        }
+
+        // Cdigo: distancia al prximo 0x00 o al final
+        for(end = exportDumpNext; end < EXPORT_DUMP_PAYLOAD && EXPORT_dumpPayload(end); end++);
+        *byte = end - exportDumpNext + 1;
+        exportDumpRun = end - exportDumpNext;
+        exportDumpLast = (end == EXPORT_DUMP_PAYLOAD);
+    }
+    else
+    {
+        *byte = EXPORT_dumpPayload(exportDumpNext++);
+        exportDumpRun--;
+    }
+
+    // El 0x00 que cierra el bloque lo reemplaza el prximo cdigo
+    if(exportDumpRun == 0 && !exportDumpLast)
+        exportDumpNext++;
+
+    return(1);
+}
+//*****************************************************************************
+uint8_t EXPORT_init(const uint32_t baud)
+{
+    EUSCI_A_UART_initParam param = {0};
+    uint32_t clock = CS_getSMCLK();
+
+    if(baud < 100 || clock < baud)
+        return(STATUS_FAIL);
+
+    RINGBUF_initBytes(&exportTx, exportData, EXPORT_TX_SIZE);
+    exportDrops = 0;
+    exportWake = 0;
+    exportRingFrame = 0;
+    exportDumping = 0;
+    exportDumpRecord = 0;
+
+    param.selectClockSource = EUSCI_A_UART_CLOCKSOURCE_SMCLK;
+    param.parity = EUSCI_A_UART_NO_PARITY;
+    param.msborLsbFirst = EUSCI_A_UART_LSB_FIRST;
+    param.numberofStopBits = EUSCI_A_UART_ONE_STOP_BIT;
+    param.uartMode = EUSCI_A_UART_MODE;
+    EXPORT_setBaud(clock, baud, &param);
+
+    P1SEL0 |= BIT0;                         // UCA0TXD
+
+    if(EUSCI_A_UART_init(EUSCI_A0_BASE, &param) == STATUS_FAIL)
+        return(STATUS_FAIL);
+    EUSCI_A_UART_enable(EUSCI_A0_BASE);
+
+    return(STATUS_SUCCESS);
+}
+//*****************************************************************************
+uint8_t EXPORT_send(const uint8_t type, const uint8_t* data, const uint8_t length)
+{
+    uint8_t frame[EXPORT_FRAME_SIZE(EXPORT_PAYLOAD_MAX)];
+    uint8_t size = EXPORT_FRAME_SIZE(length);
+    uint8_t code = 0;
+    uint8_t i;
+    uint16_t crc;
+
+    if(length > EXPORT_PAYLOAD_MAX ||
+       (uint16_t)(EXPORT_TX_SIZE - RINGBUF_countBytes(&exportTx)) < size)
+    {
+        exportDrops++;
+        return(STATUS_FAIL);
+    }
+
+    // Tipo y datos a partir de frame[1], CRC a medida que se copian
+    CRC_setSeed(CRC_BASE, EXPORT_CRC_SEED);
+    frame[1] = type;
+    CRC_set8BitData(CRC_BASE, type);
+    for(i = 0; i < length; i++)
+    {
+        frame[i + 2] = data[i];
+        CRC_set8BitData(CRC_BASE, data[i]);
+    }
+    crc = CRC_getResult(CRC_BASE);
+    frame[length + 2] = (uint8_t)crc;
+    frame[length + 3] = (uint8_t)(crc >> 8);
+
+    // COBS en el lugar: cada 0x00 pasa a ser la distancia al siguiente
+    for(i = 1; i < size - 1; i++)
+    {
+        if(frame[i] == 0)
+        {
+            frame[code] = i - code;
+            code = i;
+        }
+    }
+    frame[code] = size - 1 - code;
+    frame[size - 1] = 0x00;                 // Delimitador
+
+    for(i = 0; i < size; i++)
+        RINGBUF_putByte(&exportTx, frame[i]);
+
+    EUSCI_A_UART_enableInterrupt(EUSCI_A0_BASE, EUSCI_A_UART_TRANSMIT_INTERRUPT);
+
+    return(STATUS_SUCCESS);
+}
+//*****************************************************************************
+uint8_t EXPORT_sendBlock(const uint8_t* block, const uint8_t length)
+{
+    if(length == 0)
+        return(STATUS_FAIL);
+
+    return(EXPORT_send(EXPORT_BLOCK, block, length));
+}
+//*****************************************************************************
+uint8_t EXPORT_dump(const uint16_t sequence)
+{
+    uint16_t gie = __get_SR_register() & GIE;
+    uint8_t status = STATUS_FAIL;
+
+    __disable_interrupt();
+    if(!exportDumping && !exportDumpRecord)
+    {
+        exportDumpSequence = sequence;
+        exportDumping = 1;
+        EUSCI_A_UART_enableInterrupt(EUSCI_A0_BASE, EUSCI_A_UART_TRANSMIT_INTERRUPT);
+        status = STATUS_SUCCESS;
+    }
+    __bis_SR_register(gie);
+
+    return(status);
+}
+//*****************************************************************************
+void EXPORT_stopDump(void)
+{
+    exportDumping = 0;
+}
+//*****************************************************************************
+uint8_t EXPORT_isDumping(void)
+{
+    return(exportDumping || exportDumpRecord);
+}
+//*****************************************************************************
+uint16_t EXPORT_dumpPosition(void)
+{
+    return(exportDumpSequence);
+}
+//*****************************************************************************
+uint16_t EXPORT_pending(void)
+{
+    return(RINGBUF_countBytes(&exportTx));
+}
+//*****************************************************************************
+uint16_t EXPORT_takeDrops(void)
+{
+    uint16_t drops = exportDrops;
+
+    exportDrops = 0;
+
+    return(drops);
+}
+//*****************************************************************************
+void EXPORT_sleep(void)
+{
+    __disable_interrupt();
+    if(RINGBUF_countBytes(&exportTx) || (UCA0IE & (UCTXIE | UCTXCPTIE)))
+    {
+        exportWake = 1;
+        __bis_SR_register(LPM0_bits + GIE);
+    }
+    else
+        __bis_SR_register(LPM3_bits + GIE);
+    exportWake = 0;
+}
+//***************************************************************************************************************
+// eUSCI_A0 interrupt service routine
+#if defined(__TI_COMPILER_VERSION__) || defined(__IAR_SYSTEMS_ICC__)
+#pragma vector = USCI_A0_VECTOR
+__interrupt void USCI_A0_ISR(void)
+#elif defined(__GNUC__)
+void __attribute__ ((interrupt(USCI_A0_VECTOR))) USCI_A0_ISR (void)
+#else
+#error Compiler not supported!
+#endif
+{
+    uint8_t byte;
+    uint8_t data;
+
+    switch(__even_in_range(UCA0IV, USCI_UART_UCTXCPTIFG))
+    {
+        case USCI_UART_UCTXIFG:
+            // Se cambia de fuente solo entre tramas; EXPORT_send() tiene prioridad
+            if(!exportDumpRecord && RINGBUF_getByte(&exportTx, &byte) == STATUS_SUCCESS)
+            {
+                UCA0TXBUF = byte;
+                exportRingFrame = (byte != 0x00);
+            }
+            else if(!exportRingFrame && EXPORT_dumpByte(&data))
+                UCA0TXBUF = data;
+            else
+            {
+                // Vaco, EXPORT_send() la vuelve a habilitar. Leer UCA0IV
+                // limpi UCTXIFG y sin un byte nuevo no vuelve: se restaura
+                // para que la interrupcin llegue al habilitarla. Falta que
+                // salga el ltimo byte
+                UCA0IE &= ~UCTXIE;
+                UCA0IFG = (UCA0IFG & ~UCTXCPTIFG) | UCTXIFG;
+                UCA0IE |= UCTXCPTIE;
+            }
+            break;
+        case USCI_UART_UCTXCPTIFG:
+            UCA0IE &= ~UCTXCPTIE;
+            if(exportWake)
+                __bic_SR_register_on_exit(LPM3_bits);   // Wake EXPORT_sleep(), keep GIE
+            break;
+        default:
+            break;
+    }
+}
@@ -0,0 +1,265 @@
+/**
+  * @file     export.h
+  * @brief    Salida de mediciones por UART en tramas binarias.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// export.h - Tramas COBS por el eUSCI_A0 encoladas en un buffer circular que
+//            vaca la interrupcin de transmisin.
+//
+//*****************************************************************************
+
+#ifndef EXPORT_H_
+#define EXPORT_H_
+
+//*****************************************************************************
+//                              Include
+//*****************************************************************************
+#include "driverlib.h"
+#include "ringbuf.h"
+#include "log.h"
+#include "codec.h"
+
+//*****************************************************************************
+//                              Definiciones
+//*****************************************************************************
+//*****************************************************************************
+//! \details Velocidad por defecto en baudios. Con SMCLK de 1 MHz 115200 es
+//!          lo ms alto con un error aceptable; con SMCLK mayor se puede
+//!          subir.
+//*****************************************************************************
+#ifndef EXPORT_BAUD
+#define EXPORT_BAUD 115200UL
+#endif
+
+//*****************************************************************************
+//! \details Bytes del buffer de transmisin, potencia de 2. Ocupa
+//!          \b EXPORT_TX_SIZE bytes de RAM en un \b RINGBUF_bytes.
+//*****************************************************************************
+#define EXPORT_TX_SIZE 128
+
+//*****************************************************************************
+//! \details Mximo de bytes de datos de una trama.
+//*****************************************************************************
+#define EXPORT_PAYLOAD_MAX 32
+
+#if CODEC_BLOCK_SIZE > EXPORT_PAYLOAD_MAX
+#error "Un bloque de codec.h debe entrar en una trama EXPORT_BLOCK"
+#endif
+
+//*****************************************************************************
+//! \details Bytes de una trama en la lnea: cdigo COBS, tipo, datos, CRC y
+//!          delimitador.
+//*****************************************************************************
+#define EXPORT_FRAME_SIZE(length) ((length) + 5)
+
+//*****************************************************************************
+//! \details Semilla del CRC-16 de cada trama.
+//*****************************************************************************
+#define EXPORT_CRC_SEED 0xFFFF
+
+//*****************************************************************************
+//! \details Bytes antes de COBS de una trama \b EXPORT_RECORD: tipo, registro
+//!          y CRC.
+//*****************************************************************************
+#define EXPORT_DUMP_PAYLOAD (1 + sizeof(LOG_record) + 2)
+
+//*****************************************************************************
+//! @name Tipos de trama:
+//! @{
+//*****************************************************************************
+#define EXPORT_MEASURE 0x01                 // Registro de LOG_WORDS palabras
+#define EXPORT_BLOCK   0x02                 // Bloque de CODEC_finish()
+#define EXPORT_PROFILE 0x03                 // Fase de ADC_profileDump()
+#define EXPORT_RECORD  0x04                 // LOG_record ledo de la FRAM
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//                              Funciones Prototipos
+//*****************************************************************************
+//*****************************************************************************
+//! \brief Calcula los divisores del eUSCI para una velocidad.
+//!
+//! \details \b Descripcin \n
+//!          Sigue el procedimiento de la gua de usuario: N = reloj / baudios,
+//!          con sobremuestreo si N > 16, UCBRFx de la parte entera de N y
+//!          UCBRSx de la tabla segn la parte fraccionaria de N.
+//!
+//! \param clock Frecuencia de BRCLK en Hz.
+//! \param baud Velocidad en baudios, al menos 100.
+//! \param param Parmetros de EUSCI_A_UART_init() a completar.
+//!
+//! \return \c void
+//*****************************************************************************
+static void EXPORT_setBaud(const uint32_t clock, const uint32_t baud,
+                           EUSCI_A_UART_initParam* param);
+
+//*****************************************************************************
+//! \brief Byte de la trama \b EXPORT_RECORD en curso, antes de COBS.
+//!
+//! \param position Posicin, menor que \b EXPORT_DUMP_PAYLOAD.
+//!
+//! \return \c Tipo, byte del registro en FRAM o byte del CRC.
+//*****************************************************************************
+static inline uint8_t EXPORT_dumpPayload(const uint8_t position);
+
+//*****************************************************************************
+//! \brief Prximo registro a volcar.
+//!
+//! \details \b Descripcin \n
+//!          Si la secuencia pedida ya se pis salta al registro ms antiguo,
+//!          saltea los registros sin marca de commit y termina el volcado al
+//!          alcanzar el ltimo registro guardado. Calcula el CRC de la trama
+//!          con el mdulo CRC y luego restaura su estado, ya que la
+//!          interrupcin puede llegar en medio de un clculo del programa
+//!          principal.
+//!
+//! \return \c Registro en FRAM o \c 0 si el volcado termin.
+//*****************************************************************************
+static const LOG_record* EXPORT_dumpNext(void);
+
+//*****************************************************************************
+//! \brief Prximo byte del volcado, ya codificado con COBS.
+//!
+//! \details \b Descripcin \n
+//!          COBS necesita saber dnde est el prximo 0x00 antes de enviar el
+//!          cdigo de cada bloque. Como la trama se lee de la FRAM por
+//!          puntero se puede mirar hacia adelante sin copiarla.
+//!
+//! \param byte Puntero donde se guarda el byte.
+//!
+//! \return \c 1 si hay byte o \c 0 si el volcado termin.
+//*****************************************************************************
+static uint8_t EXPORT_dumpByte(uint8_t* byte);
+
+//*****************************************************************************
+//! \brief Inicializa el eUSCI_A0 como UART con SMCLK y el buffer de
+//!        transmisin.
+//!
+//! \details \b Descripcin \n
+//!          8 bits, sin paridad y un bit de parada. Configura P1.0 como
+//!          UCA0TXD. La recepcin no se utiliza.
+//!
+//! \param baud Velocidad en baudios, normalmente \b EXPORT_BAUD.
+//!
+//! \return \c STATUS_SUCCESS o \c STATUS_FAIL si SMCLK es menor que \p baud.
+//*****************************************************************************
+uint8_t EXPORT_init(const uint32_t baud);
+
+//*****************************************************************************
+//! \brief Encola una trama para transmitir.
+//!
+//! \details \b Descripcin \n
+//!          La trama es COBS(tipo, datos, CRC bajo, CRC alto) seguida de un
+//!          0x00, de modo que el receptor se sincroniza en el prximo 0x00
+//!          luego de un error. El CRC-16 se calcula con el mdulo CRC sobre el
+//!          tipo y los datos (CRC-CCITT, semilla \b EXPORT_CRC_SEED, cada byte
+//!          desde el bit 0). Nunca espera a la lnea: si la trama no entra
+//!          completa en el buffer se descarta entera.
+//!
+//! \param type Tipo de trama.
+//! \param data Datos.
+//! \param length Bytes de \p data, hasta \b EXPORT_PAYLOAD_MAX.
+//!
+//! \return \c STATUS_SUCCESS si se encol o \c STATUS_FAIL si se descart.
+//!
+//! \attention Usa el mdulo CRC.
+//*****************************************************************************
+uint8_t EXPORT_send(const uint8_t type, const uint8_t* data, const uint8_t length);
+
+//*****************************************************************************
+//! \brief Encola un bloque comprimido en una trama \b EXPORT_BLOCK.
+//!
+//! \details \b Descripcin \n
+//!          Los datos de la trama son el bloque tal como lo deja
+//!          CODEC_finish(); el receptor lo pasa a CODEC_decode(). Con la seal
+//!          EC5 de host/test_codec.c un bloque de 64 muestras ocupa unos 29
+//!          bytes en la lnea, menos de 0,5 bytes por muestra contra 3,25 de
+//!          \b EXPORT_MEASURE.
+//!
+//! \param block Bloque.
+//! \param length Bytes de \p block, el valor devuelto por CODEC_finish().
+//!
+//! \return \c STATUS_SUCCESS si se encol o \c STATUS_FAIL si se descart o
+//!         \p length es 0.
+//!
+//! \attention Usa el mdulo CRC.
+//*****************************************************************************
+uint8_t EXPORT_sendBlock(const uint8_t* block, const uint8_t length);
+
+//*****************************************************************************
+//! \brief Vuelca el registro de la FRAM sin copiarlo a RAM.
+//!
+//! \details \b Descripcin \n
+//!          La interrupcin de transmisin lee cada registro de la FRAM por
+//!          puntero y lo enva en una trama \b EXPORT_RECORD: COBS(tipo,
+//!          LOG_record, CRC-16) y 0x00, con el CRC calculado como en
+//!          EXPORT_send(). El registro incluye su secuencia y su propio CRC.
+//!          Las tramas de EXPORT_send() tienen prioridad y se intercalan entre
+//!          registros, nunca en medio de una trama. Si LOG_append() pisa un
+//!          registro mientras se enva, la trama llega con un CRC invlido.
+//!
+//! \param sequence Secuencia del primer registro; LOG_firstSequence() para
+//!                 volcar todo o la siguiente a la ltima recibida para
+//!                 retomar.
+//!
+//! \return \c STATUS_SUCCESS o \c STATUS_FAIL si ya hay un volcado en curso.
+//*****************************************************************************
+uint8_t EXPORT_dump(const uint16_t sequence);
+
+//*****************************************************************************
+//! \brief Detiene el volcado al terminar la trama en curso.
+//!
+//! \return \c void
+//*****************************************************************************
+void EXPORT_stopDump(void);
+
+//*****************************************************************************
+//! \brief Indica si hay un volcado en curso.
+//!
+//! \return \c 1 hasta enviar el ltimo registro o detenerlo.
+//*****************************************************************************
+uint8_t EXPORT_isDumping(void);
+
+//*****************************************************************************
+//! \brief Secuencia del prximo registro a volcar, para retomar.
+//!
+//! \return \c Secuencia.
+//*****************************************************************************
+uint16_t EXPORT_dumpPosition(void);
+
+//*****************************************************************************
+//! \brief Bytes pendientes de transmitir.
+//!
+//! \return \c Bytes en el buffer.
+//*****************************************************************************
+uint16_t EXPORT_pending(void);
+
+//*****************************************************************************
+//! \brief Obtiene y reinicia el contador de tramas descartadas.
+//!
+//! \return \c Tramas descartadas desde la ltima consulta.
+//*****************************************************************************
+uint16_t EXPORT_takeDrops(void);
+
+//*****************************************************************************
+//! \brief Espera en bajo consumo sin cortar la transmisin.
+//!
+//! \details \b Descripcin \n
+//!          SMCLK se detiene en LPM3, por lo que mientras quede algo por
+//!          transmitir entra en LPM0 y la interrupcin lo despierta cuando
+//!          termina de salir el ltimo byte (UCTXCPTIFG). Si no entra en LPM3.
+//!          Pensada para el lazo de espera de main(); la interrupcin no sale
+//!          de LPM en ningn otro caso.
+//!
+//! \return \c void
+//*****************************************************************************
+void EXPORT_sleep(void);
+
+#endif /* EXPORT_H_ */
@@ -19,45 +19,8 @@ void GPIO_configPins(uint16_t* selectedPort, uint16_t* selectedPin)
     uint16_t port = *(selectedPort);
     uint8_t  pin  = *(selectedPin);
 
-    switch (port)
-        {
-            case 1:
-                *(selectedPin) = (0x0001 << pin);
-                *(selectedPort) = 0x0200;
-                break;
-            case 2:
-                *(selectedPin) = (0x0001 << pin);
-                *(selectedPin) <<= 8;
-                *(selectedPort) =  0x0200;
-                break;
-            case 3:
-                *(selectedPin) = (0x0001 << pin);
-                *(selectedPort) = 0x0220;
-                break;
-            case 4:
-                *(selectedPin) = (0x0001 << pin);
-                *(selectedPin) <<= 8;
-                *(selectedPort) = 0x0220;
-                break;
-            case 5:
-                *(selectedPin) = (0x0001 << pin);
-                *(selectedPort) = 0x0240;
-                break;
-            case 6:
-                *(selectedPin) = (0x0001 << pin);
-                *(selectedPin) <<= 8;
-                *(selectedPort) = 0x0240;
-                break;
-            case 7:
-                *(selectedPin) = (0x0001 << pin);
-                *(selectedPort) = 0x0260;
-                break;
-            case 8:
-                *(selectedPin) = (0x0001 << pin);
-                *(selectedPin) <<= 8;
-                *(selectedPort) = 0x0260;
-                break;
-        }
+    *(selectedPin) = GPIO_PIN_MASK(port, pin);
+    *(selectedPort) = GPIO_PORT_BASE(port);
 }
 //*****************************************************************************
 void GPIO_powerOnSensor(const uint8_t vccPort, const uint8_t vccPin)
@@ -77,3 +40,39 @@ void GPIO_powerOffSensor(const uint8_t vccPort, const uint8_t vccPin)
     GPIO_configPins(&selectedPortVcc, &selectedPinVcc);
     GPIO_setLowOnPin(selectedPortVcc, selectedPinVcc);
 }
+//*****************************************************************************
+void GPIO_clearGroup(GPIO_group* group)
+{
+    uint8_t i;
+
+    for(i = 0; i < GPIO_PORT_PAIRS; i++)
+        group->mask[i] = 0;
+}
+//*****************************************************************************
+void GPIO_powerOnGroup(const GPIO_group* group)
+{
+    uint16_t base = GPIO_PORT_BASE(1);
+    uint8_t i;
+
+    for(i = 0; i < GPIO_PORT_PAIRS; i++, base += 0x0020)
+    {
+        if(group->mask[i])
+        {
+            GPIO_driveHighOnPin(base, group->mask[i]);
+        }
+    }
+}
+//*****************************************************************************
+void GPIO_powerOffGroup(const GPIO_group* group)
+{
+    uint16_t base = GPIO_PORT_BASE(1);
+    uint8_t i;
+
+    for(i = 0; i < GPIO_PORT_PAIRS; i++, base += 0x0020)
+    {
+        if(group->mask[i])
+        {
+            GPIO_driveLowOnPin(base, group->mask[i]);
+        }
+    }
+}
@@ -45,6 +45,18 @@
                                                                     HWREG16(baseAddress + OFS_PAREN) &= ~selectedPin;   \
                                                                     HWREG16(baseAddress + OFS_PAOUT) &= ~selectedPin;
 //*****************************************************************************
+//! \details Coloca un pin como salida en alto con dos escrituras. No modifica
+//!          \b PxREN: con el pin como salida la resistencia no tiene efecto.
+//!          \b PxOUT se escribe primero para no manejar el nivel anterior.
+//*****************************************************************************
+#define GPIO_driveHighOnPin(baseAddress, selectedPin)               HWREG16(baseAddress + OFS_PAOUT) |=  selectedPin;   \
+                                                                    HWREG16(baseAddress + OFS_PADIR) |=  selectedPin;
+//*****************************************************************************
+//! \details Coloca un pin como salida en bajo con dos escrituras.
+//*****************************************************************************
+#define GPIO_driveLowOnPin(baseAddress, selectedPin)                HWREG16(baseAddress + OFS_PAOUT) &= ~selectedPin;   \
+                                                                    HWREG16(baseAddress + OFS_PADIR) |=  selectedPin;
+//*****************************************************************************
 //! \details Coloca un pin como entrada.
 //*****************************************************************************
 #define GPIO_setPinAsInput(baseAddress, selectedPin)                HWREG16(baseAddress + OFS_PADIR) &= ~selectedPin;
@@ -96,6 +108,103 @@
 //! @}
 //*****************************************************************************
 
+//*****************************************************************************
+//! @name Resolucin de pines en tiempo de compilacin:
+//! \brief Calculan la direccin base y la mscara de un pin a partir del
+//!        nmero de puerto y de pin. Con argumentos constantes el compilador
+//!        resuelve todo, por lo que no es necesario el \c switch() de
+//!        GPIO_configPins(): los puertos impares y pares comparten la base
+//!        (\b 0x0200 para P1/P2, \b 0x0220 para P3/P4, etc.) y los pares
+//!        utilizan la parte alta del registro de 16 bits.
+//! @{
+//*****************************************************************************
+
+//*****************************************************************************
+//! \details Direccin base del par de puertos al que pertenece \b port.
+//*****************************************************************************
+#define GPIO_PORT_BASE(port)                                        (0x0200 + ((((port) - 1) >> 1) * 0x0020))
+
+//*****************************************************************************
+//! \details Mscara de 16 bits del pin \b pin del puerto \b port.
+//*****************************************************************************
+#define GPIO_PIN_MASK(port, pin)                                    ((uint16_t)((0x0001 << (pin)) << ((((port) - 1) & 0x01) * 8)))
+
+//*****************************************************************************
+//! \details Inicializador de un \ref GPIO_pin resuelto en compilacin.
+//*****************************************************************************
+#define GPIO_PIN(port, pin)                                         { GPIO_PORT_BASE(port), GPIO_PIN_MASK(port, pin) }
+
+//*****************************************************************************
+//! \details Enciende un sensor cuyo pin es constante y lo deja como salida.
+//!          Se compila como dos instrucciones \b BIS con operando inmediato y
+//!          destino absoluto (\b PxOUT y \b PxDIR), sin llamadas ni
+//!          clculos. Basta para la primera vez; una vez que el pin es salida
+//!          conviene usar GPIO_SET_PIN() y GPIO_CLEAR_PIN().
+//!
+//!          En el simulador (host/test_gpio.c) encender y apagar un pin
+//!          cuesta 60 ciclos con GPIO_powerOnSensor() y GPIO_powerOffSensor(),
+//!          16 con GPIO_POWER_ON() y GPIO_POWER_OFF() y 8 con GPIO_SET_PIN() y
+//!          GPIO_CLEAR_PIN(), contando llamadas y accesos a registros; el
+//!          modelo no cuenta los clculos de GPIO_configPins().
+//*****************************************************************************
+#define GPIO_POWER_ON(port, pin)                                    GPIO_driveHighOnPin(GPIO_PORT_BASE(port), GPIO_PIN_MASK(port, pin))
+
+//*****************************************************************************
+//! \details Apaga un sensor cuyo pin es constante y lo deja como salida en
+//!          bajo, con dos instrucciones \b BIC y \b BIS.
+//*****************************************************************************
+#define GPIO_POWER_OFF(port, pin)                                   GPIO_driveLowOnPin(GPIO_PORT_BASE(port), GPIO_PIN_MASK(port, pin))
+
+//*****************************************************************************
+//! \details Pone en alto un pin constante ya configurado como salida con
+//!          GPIO_POWER_OFF() o GPIO_POWER_ON(). Se compila como una nica
+//!          instruccin \b BIS.
+//*****************************************************************************
+#define GPIO_SET_PIN(port, pin)                                     HWREG16(GPIO_PORT_BASE(port) + OFS_PAOUT) |= GPIO_PIN_MASK(port, pin);
+
+//*****************************************************************************
+//! \details Pone en bajo un pin constante ya configurado como salida. Se
+//!          compila como una nica instruccin \b BIC.
+//*****************************************************************************
+#define GPIO_CLEAR_PIN(port, pin)                                   HWREG16(GPIO_PORT_BASE(port) + OFS_PAOUT) &= ~GPIO_PIN_MASK(port, pin);
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! \brief Pin resuelto: direccin base del puerto y mscara del pin.
+//!
+//! \details Se inicializa con \b GPIO_PIN() para que el clculo se haga en
+//!          tiempo de compilacin y, en ejecucin, encender o apagar el pin
+//!          sean solo accesos directos a los registros.
+//*****************************************************************************
+typedef struct GPIO_pin
+{
+    //! Direccin base del par de puertos (\b PA, \b PB, ...).
+    uint16_t base;
+    //! Mscara del pin dentro del registro de 16 bits.
+    uint16_t mask;
+} GPIO_pin;
+
+//*****************************************************************************
+//! \details Cantidad de pares de puertos de 16 bits (P1/P2 a P7/P8).
+//*****************************************************************************
+#define GPIO_PORT_PAIRS                                             4
+
+//*****************************************************************************
+//! \brief Grupo de pines que se encienden o apagan juntos.
+//!
+//! \details Guarda una mscara por cada par de puertos, de modo que todos los
+//!          pines de un mismo par se modifican con una sola escritura por
+//!          registro en lugar de tres escrituras por pin.
+//*****************************************************************************
+typedef struct GPIO_group
+{
+    //! Mscara de pines de cada par de puertos (\b PA a \b PD).
+    uint16_t mask[GPIO_PORT_PAIRS];
+} GPIO_group;
+
 //*****************************************************************************
 //                              Funciones Prototipos
 //*****************************************************************************
@@ -106,15 +215,15 @@
 //! \details \b Descripcin \n
 //!          Funcin que recibe dos punteros como argumentos que se utilizarn
 //!          para realizar la configuracin de los pines segn la eleccin del
-//!          usuario. Para realizar la configuracin se utiliza un \c switch(),
-//!          y si se tratase de un puerto impar solamente se desplaza el pin
-//!          hacia la izquierda de acuerdo a la eleccin del usuario y se pasa
-//!          la direccin base del puerto que corresponda, por ejemplo, para
-//!          los puertos 1 y 2 que corresponden al \b PA se le asigna la
+//!          usuario. Si se tratase de un puerto impar solamente se desplaza el
+//!          pin hacia la izquierda de acuerdo a la eleccin del usuario y se
+//!          pasa la direccin base del puerto que corresponda, por ejemplo,
+//!          para los puertos 1 y 2 que corresponden al \b PA se le asigna la
 //!          direccin base \b 0x0200. Si el puerto elegido es par, adems de
 //!          lo realizado para un puerto impar, se realiza un desplazamiento al
 //!          registro parte alta que es el que corresponde para los puertos
-//!          pares.
+//!          pares. El clculo se realiza con \b GPIO_PORT_BASE() y
+//!          \b GPIO_PIN_MASK() sin bifurcaciones.
 //!
 //! \param *selectedPort Puntero que define el puerto seleccionado.
 //! \param *selectedPin Puntero que define el pin elegido en el puerto deseado.
@@ -153,4 +262,83 @@ void GPIO_powerOnSensor(const uint8_t vccPort, const uint8_t vccPin);
 //*****************************************************************************
 void GPIO_powerOffSensor(const uint8_t vccPort, const uint8_t vccPin);
 
+//*****************************************************************************
+//! \brief Funcin para encender un sensor a partir de un pin resuelto.
+//!
+//! \details \b Descripcin \n
+//!          Igual que GPIO_powerOnSensor() pero la direccin base y la mscara
+//!          ya fueron calculadas con \b GPIO_PIN(), por lo que solo se
+//!          escriben \b PxOUT y \b PxDIR.
+//!
+//! \param pin Pin de alimentacin.
+//!
+//! \return \c void.
+//*****************************************************************************
+static inline void GPIO_powerOn(const GPIO_pin* pin)
+{
+    GPIO_driveHighOnPin(pin->base, pin->mask);
+}
+
+//*****************************************************************************
+//! \brief Funcin para apagar un sensor a partir de un pin resuelto.
+//!
+//! \param pin Pin de alimentacin.
+//!
+//! \return \c void.
+//*****************************************************************************
+static inline void GPIO_powerOff(const GPIO_pin* pin)
+{
+    GPIO_driveLowOnPin(pin->base, pin->mask);
+}
+
+//*****************************************************************************
+//! \brief Funcin que vaca un grupo de pines.
+//!
+//! \param group Grupo a vaciar.
+//!
+//! \return \c void.
+//*****************************************************************************
+void GPIO_clearGroup(GPIO_group* group);
+
+//*****************************************************************************
+//! \brief Funcin que agrega un pin a un grupo.
+//!
+//! \details \b Descripcin \n
+//!          Suma la mscara del pin a la del par de puertos que le corresponde
+//!          segn su direccin base.
+//!
+//! \param group Grupo al que se agrega el pin.
+//! \param pin Pin a agregar.
+//!
+//! \return \c void.
+//*****************************************************************************
+static inline void GPIO_addToGroup(GPIO_group* group, const GPIO_pin* pin)
+{
+    group->mask[(pin->base - GPIO_PORT_BASE(1)) >> 5] |= pin->mask;
+}
+
+//*****************************************************************************
+//! \brief Funcin para encender todos los sensores de un grupo.
+//!
+//! \details \b Descripcin \n
+//!          Por cada par de puertos con pines en el grupo realiza una nica
+//!          escritura en \b PxOUT y \b PxDIR, por lo que todos los
+//!          sensores se encienden al mismo tiempo y el costo no depende de la
+//!          cantidad de pines.
+//!
+//! \param group Grupo de pines de alimentacin.
+//!
+//! \return \c void.
+//*****************************************************************************
+void GPIO_powerOnGroup(const GPIO_group* group);
+
+//*****************************************************************************
+//! \brief Funcin para apagar todos los sensores de un grupo.
+//!
+//! \param group Grupo de pines de alimentacin.
+//!
+//! \return \c void.
+//*****************************************************************************
+void GPIO_powerOffGroup(const GPIO_group* group);
+
 #endif /* GPIO_H_ */
@@ -0,0 +1,713 @@
+/**
+  * @file     msp430.h
+  * @brief    Cabecera del MSP430FR4133 simulado para compilar en la PC.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// msp430.h - Registros del MSP430FR4133 mapeados sobre el modelo simulado.
+//
+//*****************************************************************************
+
+#ifndef MSP430_H_
+#define MSP430_H_
+
+//*****************************************************************************
+//                              Include
+//*****************************************************************************
+#include <stdint.h>
+#include <stdbool.h>
+#include "msp430sim.h"
+
+//*****************************************************************************
+//                              Definiciones
+//*****************************************************************************
+//*****************************************************************************
+//! @name Mdulos presentes:
+//! \brief Habilitan las cabeceras de driverlib de los mdulos que el firmware
+//!        utiliza.
+//! @{
+//*****************************************************************************
+#define __MSP430FR4133__
+#define __MSP430_HAS_ADC__
+#define __MSP430_HAS_CRC__
+#define __MSP430_HAS_EUSCI_Ax__
+#define __MSP430_HAS_EUSCI_Bx__
+#define __MSP430_HAS_MPY32__
+#define __MSP430_HAS_WDT_A__
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! @name Acceso a los registros:
+//! \brief Los registros son posiciones de \b SIM_memory, el espacio de
+//!        direcciones de 64 KB del dispositivo simulado. Cada acceso pasa por
+//!        el modelo, que as detecta las escrituras y lecturas con efectos
+//!        (ADCSC, TACLR, ADCMEM0, ADCIV...) y hace avanzar el tiempo.
+//! @{
+//*****************************************************************************
+#define SIM_REG8(address)       (*SIM_reg8((uint16_t)(address)))
+#define SIM_REG16(address)      (*SIM_reg16((uint16_t)(address)))
+#define SIM_REG32(address)      (*SIM_reg32((uint16_t)(address)))
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! @name Reemplazo de inc/hw_memmap.h:
+//! \brief El Makefile incluye esta cabecera antes que cualquier otra, por lo
+//!        que la definicin de \b __HW_MEMMAP__ deja sin efecto la de driverlib
+//!        y los mdulos de driverlib acceden a los registros simulados.
+//! @{
+//*****************************************************************************
+#define __HW_MEMMAP__
+#define __DRIVERLIB_MSP430FR2XX_4XX_FAMILY__
+#define NDEBUG
+
+#define STATUS_SUCCESS          0x01
+#define STATUS_FAIL             0x00
+
+#define HWREG32(x)              SIM_REG32(x)
+#define HWREG16(x)              SIM_REG16(x)
+#define HWREG8(x)               SIM_REG8(x)
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! @name Intrnsecos del compilador:
+//! \brief Las entradas a bajo consumo hacen avanzar el modelo de los
+//!        perifricos hasta que una interrupcin despierta a la CPU. La
+//!        multiplicacin por software del compilador cobra sus ciclos.
+//! @{
+//*****************************************************************************
+#define __bis_SR_register(x)            SIM_bisSR(x)
+#define __bic_SR_register(x)            SIM_bicSR(x)
+#define __bis_SR_register_on_exit(x)    SIM_bisSROnExit(x)
+#define __bic_SR_register_on_exit(x)    SIM_bicSROnExit(x)
+#define __get_SR_register()             SIM_getSR()
+#define __enable_interrupt()            SIM_bisSR(GIE)
+#define __disable_interrupt()           SIM_bicSR(GIE)
+#define __delay_cycles(x)               SIM_delayCycles(x)
+#define CONV_MULTIPLY(a, b)             SIM_multiply(a, b)
+#define __even_in_range(x, y)           (x)
+#define __no_operation()
+#define __interrupt
+#define interrupt(x)
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! @name Registro de estado:
+//! @{
+//*****************************************************************************
+#define GIE                     (0x0008)
+#define CPUOFF                  (0x0010)
+#define OSCOFF                  (0x0020)
+#define SCG0                    (0x0040)
+#define SCG1                    (0x0080)
+#define LPM0_bits               (CPUOFF)
+#define LPM3_bits               (SCG1 + SCG0 + CPUOFF)
+#define LPM4_bits               (SCG1 + SCG0 + OSCOFF + CPUOFF)
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+#define BIT0                    (0x0001)
+#define BIT1                    (0x0002)
+#define BIT2                    (0x0004)
+#define BIT3                    (0x0008)
+#define BIT4                    (0x0010)
+#define BIT5                    (0x0020)
+#define BIT6                    (0x0040)
+#define BIT7                    (0x0080)
+
+//*****************************************************************************
+//! @name PMM y SYS:
+//! @{
+//*****************************************************************************
+#define PMMCTL0                 SIM_REG16(0x0120)
+#define PMMCTL0_H               SIM_REG8(0x0121)
+#define PMMCTL2                 SIM_REG16(0x0124)
+#define PM5CTL0                 SIM_REG16(0x0130)
+#define SYSCFG0                 SIM_REG16(0x0160)
+#define SYSCFG2                 SIM_REG16(0x0164)
+
+#define PMMPW                   (0xA500)
+#define PMMPW_H                 (0xA5)
+#define INTREFEN                (0x0001)
+#define REFGENRDY               (0x1000)
+#define LOCKLPM5                (0x0001)
+#define __MSP430_HAS_FRAM__
+#define SYS_BASE                (0x0140)
+#define OFS_SYSCFG0             (0x0020)
+#define OFS_SYSCFG0_L           (0x0020)
+#define FRWPPW                  (0xA500)
+#define FWPW                    (0xA500)
+#define FRAM_BASE               (0x01A0)
+#define OFS_FRCTL0              (0x0000)
+#define OFS_FRCTL0_L            (0x0000)
+#define OFS_GCCTL0              (0x0004)
+#define OFS_GCCTL1              (0x0006)
+#define NWAITS_0                (0x0000)
+#define NWAITS_1                (0x0010)
+#define NWAITS_2                (0x0020)
+#define NWAITS_3                (0x0030)
+#define NWAITS_4                (0x0040)
+#define NWAITS_5                (0x0050)
+#define NWAITS_6                (0x0060)
+#define NWAITS_7                (0x0070)
+#define PFWP                    (0x0001)
+#define DFWP                    (0x0002)
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! @name SFR y CS:
+//! \brief Solo se modelan los valores de reset: DCOCLKDIV (FLL con REFO,
+//!        N = 31) para MCLK y SMCLK y REFO para ACLK. Las escrituras quedan
+//!        en los registros pero no cambian los relojes del modelo.
+//! @{
+//*****************************************************************************
+#define __MSP430_HAS_CS__
+#define SFR_BASE                (0x0100)
+#define CS_BASE                 (0x0180)
+
+#define OFS_SFRIE1              (0x0000)
+#define OFS_SFRIE1_L            (0x0000)
+#define OFS_SFRIFG1             (0x0002)
+#define OFS_CSCTL0              (0x0000)
+#define OFS_CSCTL1              (0x0002)
+#define OFS_CSCTL2              (0x0004)
+#define OFS_CSCTL3              (0x0006)
+#define OFS_CSCTL4              (0x0008)
+#define OFS_CSCTL4_L            (0x0008)
+#define OFS_CSCTL5              (0x000A)
+#define OFS_CSCTL6              (0x000C)
+#define OFS_CSCTL6_L            (0x000C)
+#define OFS_CSCTL7              (0x000E)
+#define OFS_CSCTL7_L            (0x000E)
+#define OFS_CSCTL8              (0x0010)
+
+#define OFIE                    (0x0002)
+#define OFIFG                   (0x0002)
+
+#define DCO0                    (0x0001)
+#define DCO1                    (0x0002)
+#define DCO2                    (0x0004)
+#define DCO3                    (0x0008)
+#define DCO4                    (0x0010)
+#define DCO5                    (0x0020)
+#define DCO6                    (0x0040)
+#define DCO7                    (0x0080)
+#define DCO8                    (0x0100)
+#define DCOFTRIMEN              (0x0080)
+#define DCOFTRIM0               (0x0010)
+#define DCOFTRIM1               (0x0020)
+#define DCOFTRIM2               (0x0040)
+#define DCORSEL_0               (0x0000)
+#define DCORSEL_1               (0x0002)
+#define DCORSEL_2               (0x0004)
+#define DCORSEL_3               (0x0006)
+#define DCORSEL_4               (0x0008)
+#define DCORSEL_5               (0x000A)
+#define DCORSEL_6               (0x000C)
+#define DCORSEL_7               (0x000E)
+#define FLLN0                   (0x0001)
+#define FLLN1                   (0x0002)
+#define FLLN2                   (0x0004)
+#define FLLN3                   (0x0008)
+#define FLLN4                   (0x0010)
+#define FLLN5                   (0x0020)
+#define FLLN6                   (0x0040)
+#define FLLN7                   (0x0080)
+#define FLLN8                   (0x0100)
+#define FLLN9                   (0x0200)
+#define FLLD__1                 (0x0000)
+#define FLLD__2                 (0x1000)
+#define FLLREFDIV_7             (0x0007)
+#define SELREF_3                (0x0030)
+#define SELREF__XT1CLK          (0x0000)
+#define SELREF__REFOCLK         (0x0010)
+#define SELMS_7                 (0x0007)
+#define SELMS__DCOCLKDIV        (0x0000)
+#define SELMS__REFOCLK          (0x0001)
+#define SELMS__XT1CLK           (0x0002)
+#define SELMS__VLOCLK           (0x0003)
+#define SELA                    (0x0100)
+#define SELA__XT1CLK            (0x0000)
+#define SELA__REFOCLK           (0x0100)
+#define DIVM_7                  (0x0007)
+#define DIVM__1                 (0x0000)
+#define DIVM__2                 (0x0001)
+#define DIVM__4                 (0x0002)
+#define DIVM__8                 (0x0003)
+#define DIVM__16                (0x0004)
+#define DIVM__32                (0x0005)
+#define DIVM__64                (0x0006)
+#define DIVM__128               (0x0007)
+#define DIVS_3                  (0x0030)
+#define SMCLKOFF                (0x0100)
+#define VLOAUTOOFF              (0x1000)
+#define XT1AUTOOFF              (0x0001)
+#define XT1AGCOFF               (0x0002)
+#define XT1BYPASS               (0x0010)
+#define XTS                     (0x0020)
+#define XT1DRIVE_0              (0x0000)
+#define XT1DRIVE_3              (0x00C0)
+#define XT1DRIVE0_L             (0x0040)
+#define XT1DRIVE1_L             (0x0080)
+#define DCOFFG                  (0x0001)
+#define XT1OFFG                 (0x0002)
+#define FLLULIFG                (0x0010)
+#define FLLUNLOCK0              (0x0100)
+#define FLLUNLOCK1              (0x0200)
+#define FLLULPUC                (0x1000)
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! @name Puertos:
+//! @{
+//*****************************************************************************
+#define OFS_PAIN                (0x0000)
+#define OFS_PAOUT               (0x0002)
+#define OFS_PADIR               (0x0004)
+#define OFS_PAREN               (0x0006)
+#define OFS_PASEL0              (0x000A)
+#define OFS_PASEL1              (0x000C)
+
+#define P1IN                    SIM_REG8(0x0200)
+#define P2IN                    SIM_REG8(0x0201)
+#define P1OUT                   SIM_REG8(0x0202)
+#define P2OUT                   SIM_REG8(0x0203)
+#define P1DIR                   SIM_REG8(0x0204)
+#define P2DIR                   SIM_REG8(0x0205)
+#define P1REN                   SIM_REG8(0x0206)
+#define P2REN                   SIM_REG8(0x0207)
+#define P1SEL0                  SIM_REG8(0x020A)
+#define P2SEL0                  SIM_REG8(0x020B)
+#define P5SEL0                  SIM_REG8(0x024A)
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! @name Timer_A:
+//! @{
+//*****************************************************************************
+#define TIMER_A0_BASE           (0x0300)
+#define TIMER_A1_BASE           (0x0340)
+
+#define TA0CTL                  SIM_REG16(0x0300)
+#define TA0CCTL0                SIM_REG16(0x0302)
+#define TA0CCTL1                SIM_REG16(0x0304)
+#define TA0CCTL2                SIM_REG16(0x0306)
+#define TA0R                    SIM_REG16(0x0310)
+#define TA0CCR0                 SIM_REG16(0x0312)
+#define TA0CCR1                 SIM_REG16(0x0314)
+#define TA0CCR2                 SIM_REG16(0x0316)
+#define TA0EX0                  SIM_REG16(0x0320)
+#define TA0IV                   SIM_REG16(0x032E)
+
+#define TA1CTL                  SIM_REG16(0x0340)
+#define TA1CCTL0                SIM_REG16(0x0342)
+#define TA1CCTL1                SIM_REG16(0x0344)
+#define TA1CCTL2                SIM_REG16(0x0346)
+#define TA1R                    SIM_REG16(0x0350)
+#define TA1CCR0                 SIM_REG16(0x0352)
+#define TA1CCR1                 SIM_REG16(0x0354)
+#define TA1CCR2                 SIM_REG16(0x0356)
+#define TA1EX0                  SIM_REG16(0x0360)
+#define TA1IV                   SIM_REG16(0x036E)
+
+#define TAIFG                   (0x0001)
+#define TAIE                    (0x0002)
+#define TACLR                   (0x0004)
+#define MC                      (0x0030)
+#define MC_0                    (0x0000)
+#define MC_1                    (0x0010)
+#define MC_2                    (0x0020)
+#define MC_3                    (0x0030)
+#define ID                      (0x00C0)
+#define ID_0                    (0x0000)
+#define ID_1                    (0x0040)
+#define ID_2                    (0x0080)
+#define ID_3                    (0x00C0)
+#define TASSEL                  (0x0300)
+#define TASSEL_0                (0x0000)
+#define TASSEL_1                (0x0100)
+#define TASSEL_2                (0x0200)
+#define TASSEL__ACLK            (0x0100)
+#define TASSEL__SMCLK           (0x0200)
+
+#define CCIFG                   (0x0001)
+#define CCIE                    (0x0010)
+#define OUTMOD                  (0x00E0)
+#define OUTMOD_0                (0x0000)
+#define OUTMOD_3                (0x0060)
+#define OUTMOD_7                (0x00E0)
+
+#define TAIDEX                  (0x0007)
+#define TAIDEX_0                (0x0000)
+#define TAIDEX_1                (0x0001)
+#define TAIDEX_2                (0x0002)
+#define TAIDEX_3                (0x0003)
+#define TAIDEX_4                (0x0004)
+#define TAIDEX_5                (0x0005)
+#define TAIDEX_6                (0x0006)
+#define TAIDEX_7                (0x0007)
+
+#define TA0IV_NONE              (0x0000)
+#define TA0IV_TACCR1            (0x0002)
+#define TA0IV_TACCR2            (0x0004)
+#define TA0IV_TAIFG             (0x000E)
+#define TA1IV_NONE              (0x0000)
+#define TA1IV_TACCR1            (0x0002)
+#define TA1IV_TACCR2            (0x0004)
+#define TA1IV_TAIFG             (0x000E)
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! @name MPY32:
+//! \brief Se modelan las operaciones de 16 x 16 bits (MPY, MPYS, MAC y MACS)
+//!        con el modo de saturacin. El modo fraccional no se modela.
+//! @{
+//*****************************************************************************
+#define MPY32_BASE              (0x04C0)
+#define OFS_MPY                 (0x0000)
+#define OFS_MPYS                (0x0002)
+#define OFS_MAC                 (0x0004)
+#define OFS_MACS                (0x0006)
+#define OFS_OP2                 (0x0008)
+#define OFS_RESLO               (0x000A)
+#define OFS_RESHI               (0x000C)
+#define OFS_SUMEXT              (0x000E)
+#define OFS_MPY32L              (0x0010)
+#define OFS_MPY32H              (0x0012)
+#define OFS_OP2L                (0x0020)
+#define OFS_OP2H                (0x0022)
+#define OFS_RES0                (0x0024)
+#define OFS_RES1                (0x0026)
+#define OFS_RES2                (0x0028)
+#define OFS_RES3                (0x002A)
+#define OFS_MPY32CTL0           (0x002C)
+#define OFS_MPY32CTL0_L         (0x002C)
+#define MPYC                    (0x0001)
+#define MPYFRAC                 (0x0010)
+#define MPYSAT                  (0x0020)
+#define MPYDLYWRTEN             (0x0100)
+#define MPYDLY32                (0x0200)
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! @name CRC:
+//! \brief Se modela la entrada de 8 y 16 bits por \b CRCDI, cada byte desde
+//!        el bit 0 como en el dispositivo, con el polinomio CRC-CCITT. Toda
+//!        escritura en \b CRCDI cuenta aunque repita el valor.
+//! @{
+//*****************************************************************************
+#define CRC_BASE                (0x01C0)
+#define OFS_CRCDI               (0x0000)
+#define OFS_CRCDI_L             (0x0000)
+#define OFS_CRCDIRB             (0x0002)
+#define OFS_CRCDIRB_L           (0x0002)
+#define OFS_CRCINIRES           (0x0004)
+#define OFS_CRCRESR             (0x0006)
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! @name eUSCI_A0:
+//! \brief Se modela la transmisin UART: UCTXIFG al pasar \b UCA0TXBUF al
+//!        registro de desplazamiento, UCTXCPTIFG al terminar y la duracin
+//!        de cada carcter segn UCBRx, UCBRFx y UCOS16 (UCBRSx no se
+//!        modela). BRCLK es SMCLK (igual a MCLK) o ACLK. La recepcin no se
+//!        modela.
+//! @{
+//*****************************************************************************
+#define EUSCI_A0_BASE           (0x0500)
+#define OFS_UCAxCTLW0           (0x0000)
+#define OFS_UCAxCTLW0_L         (0x0000)
+#define OFS_UCAxCTLW1           (0x0002)
+#define OFS_UCAxBRW             (0x0006)
+#define OFS_UCAxMCTLW           (0x0008)
+#define OFS_UCAxSTATW           (0x000A)
+#define OFS_UCAxRXBUF           (0x000C)
+#define OFS_UCAxTXBUF           (0x000E)
+#define OFS_UCAxABCTL           (0x0010)
+#define OFS_UCAxIRCTL           (0x0012)
+#define OFS_UCAxIE              (0x001A)
+#define OFS_UCAxIFG             (0x001C)
+#define OFS_UCAxIV              (0x001E)
+
+#define UCA0CTLW0               SIM_REG16(0x0500)
+#define UCA0BRW                 SIM_REG16(0x0506)
+#define UCA0MCTLW               SIM_REG16(0x0508)
+#define UCA0STATW               SIM_REG16(0x050A)
+#define UCA0TXBUF               SIM_REG16(0x050E)
+#define UCA0IE                  SIM_REG16(0x051A)
+#define UCA0IFG                 SIM_REG16(0x051C)
+#define UCA0IV                  SIM_REG16(0x051E)
+
+#define UCSWRST                 (0x0001)
+#define UCTXBRK                 (0x0002)
+#define UCTXADDR                (0x0004)
+#define UCDORM                  (0x0008)
+#define UCBRKIE                 (0x0010)
+#define UCRXEIE                 (0x0020)
+#define UCSSEL_3                (0x00C0)
+#define UCSSEL__UCLK            (0x0000)
+#define UCSSEL__ACLK            (0x0040)
+#define UCSSEL__SMCLK           (0x0080)
+#define UCSYNC                  (0x0100)
+#define UCMODE_0                (0x0000)
+#define UCMODE_1                (0x0200)
+#define UCMODE_2                (0x0400)
+#define UCMODE_3                (0x0600)
+#define UCSPB                   (0x0800)
+#define UC7BIT                  (0x1000)
+#define UCMSB                   (0x2000)
+#define UCPAR                   (0x4000)
+#define UCPEN                   (0x8000)
+#define UCGLIT0                 (0x0001)
+#define UCGLIT1                 (0x0002)
+#define UCOS16                  (0x0001)
+#define UCBUSY                  (0x0001)
+#define UCADDR                  (0x0002)
+#define UCIDLE                  (0x0002)
+#define UCRXERR                 (0x0004)
+#define UCBRK                   (0x0008)
+#define UCPE                    (0x0010)
+#define UCOE                    (0x0020)
+#define UCFE                    (0x0040)
+#define UCLISTEN                (0x0080)
+#define UCRXIE                  (0x0001)
+#define UCTXIE                  (0x0002)
+#define UCSTTIE                 (0x0004)
+#define UCTXCPTIE               (0x0008)
+#define UCRXIFG                 (0x0001)
+#define UCTXIFG                 (0x0002)
+#define UCSTTIFG                (0x0004)
+#define UCTXCPTIFG              (0x0008)
+
+#define USCI_NONE               (0x0000)
+#define USCI_UART_UCRXIFG       (0x0002)
+#define USCI_UART_UCTXIFG       (0x0004)
+#define USCI_UART_UCSTTIFG      (0x0006)
+#define USCI_UART_UCTXCPTIFG    (0x0008)
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! @name eUSCI_B0:
+//! \brief Se modela la transmisin SPI maestro: UCTXIFG al pasar
+//!        \b UCB0TXBUF al registro de desplazamiento y 8 ciclos de BRCLK
+//!        por UCBRx por byte. BRCLK es SMCLK (igual a MCLK) o ACLK. La
+//!        recepcin no se modela. Comparte los bits con el eUSCI_A0.
+//! @{
+//*****************************************************************************
+#define EUSCI_B0_BASE           (0x0540)
+#define OFS_UCBxCTLW0           (0x0000)
+#define OFS_UCBxCTLW1           (0x0002)
+#define OFS_UCBxBRW             (0x0006)
+#define OFS_UCBxSTATW           (0x0008)
+#define OFS_UCBxTBCNT           (0x000A)
+#define OFS_UCBxRXBUF           (0x000C)
+#define OFS_UCBxTXBUF           (0x000E)
+#define OFS_UCBxIE              (0x002A)
+#define OFS_UCBxIFG             (0x002C)
+#define OFS_UCBxIV              (0x002E)
+
+#define UCB0CTLW0               SIM_REG16(0x0540)
+#define UCB0BRW                 SIM_REG16(0x0546)
+#define UCB0STATW               SIM_REG16(0x0548)
+#define UCB0TXBUF               SIM_REG16(0x054E)
+#define UCB0IE                  SIM_REG16(0x056A)
+#define UCB0IFG                 SIM_REG16(0x056C)
+#define UCB0IV                  SIM_REG16(0x056E)
+
+#define UCSTEM                  (0x0002)
+#define UCMST                   (0x0800)
+#define UCCKPL                  (0x4000)
+#define UCCKPH                  (0x8000)
+
+#define USCI_SPI_UCRXIFG        (0x0002)
+#define USCI_SPI_UCTXIFG        (0x0004)
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! @name WDT_A:
+//! @{
+//*****************************************************************************
+#define WDT_A_BASE              (0x01CC)
+#define OFS_WDTCTL              (0x0000)
+#define WDTCTL                  SIM_REG16(0x01CC)
+#define WDTPW                   (0x5A00)
+#define WDTHOLD                 (0x0080)
+#define WDTSSEL                 (0x0060)
+#define WDTTMSEL                (0x0010)
+#define WDTCNTCL                (0x0008)
+#define WDTIS                   (0x0007)
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! @name ADC:
+//! @{
+//*****************************************************************************
+#define ADC_BASE                (0x0700)
+
+#define ADCCTL0                 SIM_REG16(0x0700)
+#define ADCCTL1                 SIM_REG16(0x0702)
+#define ADCCTL2                 SIM_REG16(0x0704)
+#define ADCLO                   SIM_REG16(0x0706)
+#define ADCHI                   SIM_REG16(0x0708)
+#define ADCMCTL0                SIM_REG16(0x070A)
+#define ADCMEM0                 SIM_REG16(0x0712)
+#define ADCIE                   SIM_REG16(0x071A)
+#define ADCIFG                  SIM_REG16(0x071C)
+#define ADCIV                   SIM_REG16(0x071E)
+
+#define ADCSC                   (0x0001)
+#define ADCENC                  (0x0002)
+#define ADCON                   (0x0010)
+#define ADCMSC                  (0x0080)
+#define ADCSHT                  (0x0F00)
+#define ADCSHT_0                (0x0000)
+#define ADCSHT_1                (0x0100)
+#define ADCSHT_2                (0x0200)
+#define ADCSHT_3                (0x0300)
+#define ADCSHT_4                (0x0400)
+#define ADCSHT_5                (0x0500)
+#define ADCSHT_6                (0x0600)
+#define ADCSHT_7                (0x0700)
+#define ADCSHT_8                (0x0800)
+#define ADCSHT_9                (0x0900)
+#define ADCSHT_10               (0x0A00)
+#define ADCSHT_11               (0x0B00)
+#define ADCSHT_12               (0x0C00)
+#define ADCSHT_13               (0x0D00)
+#define ADCSHT_14               (0x0E00)
+#define ADCSHT_15               (0x0F00)
+
+#define ADCBUSY                 (0x0001)
+#define ADCCONSEQ               (0x0006)
+#define ADCCONSEQ_0             (0x0000)
+#define ADCCONSEQ_1             (0x0002)
+#define ADCCONSEQ_2             (0x0004)
+#define ADCCONSEQ_3             (0x0006)
+#define ADCSSEL_0               (0x0000)
+#define ADCSSEL_1               (0x0008)
+#define ADCSSEL_2               (0x0010)
+#define ADCDIV_0                (0x0000)
+#define ADCSHP                  (0x0200)
+#define ADCSHS                  (0x0C00)
+#define ADCSHS_0                (0x0000)
+#define ADCSHS_1                (0x0400)
+#define ADCSHS_2                (0x0800)
+#define ADCSHS_3                (0x0C00)
+
+#define ADCRES                  (0x0010)
+#define ADCRES_0                (0x0000)
+#define ADCRES_1                (0x0010)
+#define ADCPDIV_0               (0x0000)
+
+#define ADCINCH                 (0x000F)
+#define ADCINCH_0               (0x0000)
+#define ADCINCH_1               (0x0001)
+#define ADCINCH_2               (0x0002)
+#define ADCINCH_3               (0x0003)
+#define ADCINCH_4               (0x0004)
+#define ADCINCH_5               (0x0005)
+#define ADCINCH_6               (0x0006)
+#define ADCINCH_7               (0x0007)
+#define ADCINCH_8               (0x0008)
+#define ADCINCH_9               (0x0009)
+#define ADCINCH_10              (0x000A)
+#define ADCINCH_11              (0x000B)
+#define ADCINCH_12              (0x000C)
+#define ADCINCH_13              (0x000D)
+#define ADCINCH_14              (0x000E)
+#define ADCINCH_15              (0x000F)
+#define ADCSREF                 (0x0070)
+#define ADCSREF_0               (0x0000)
+#define ADCSREF_1               (0x0010)
+#define ADCSREF0                (0x0010)
+#define ADCSREF1                (0x0020)
+#define ADCSREF2                (0x0040)
+
+#define ADCIE0                  (0x0001)
+#define ADCINIE                 (0x0002)
+#define ADCLOIE                 (0x0004)
+#define ADCHIIE                 (0x0008)
+#define ADCOVIE                 (0x0010)
+#define ADCTOVIE                (0x0020)
+
+#define ADCIFG0                 (0x0001)
+#define ADCINIFG                (0x0002)
+#define ADCLOIFG                (0x0004)
+#define ADCHIIFG                (0x0008)
+#define ADCOVIFG                (0x0010)
+#define ADCTOVIFG               (0x0020)
+
+#define ADCIV_NONE              (0x0000)
+#define ADCIV_ADCOVIFG          (0x0002)
+#define ADCIV_ADCTOVIFG         (0x0004)
+#define ADCIV_ADCHIIFG          (0x0006)
+#define ADCIV_ADCLOIFG          (0x0008)
+#define ADCIV_ADCINIFG          (0x000A)
+#define ADCIV_ADCIFG            (0x000C)
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! @name Vectores de interrupcin:
+//! \brief Solo se utilizan en las directivas de interrupcin, que en la PC no
+//!        tienen efecto.
+//! @{
+//*****************************************************************************
+#define TIMER1_A1_VECTOR        (48)
+#define TIMER1_A0_VECTOR        (49)
+#define TIMER0_A1_VECTOR        (50)
+#define TIMER0_A0_VECTOR        (51)
+#define USCI_A0_VECTOR          (45)
+#define USCI_B0_VECTOR          (44)
+#define ADC_VECTOR              (40)
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+#endif /* MSP430_H_ */
@@ -0,0 +1,1302 @@
+/**
+  * @file     msp430sim.c
+  * @brief    Modelo de los perifricos del MSP430FR4133 para la compilacin en
+  *           la PC.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// msp430sim.c - Modelo de ADC, Timer_A0/A1, referencia del PMM, puertos, MPY32,
+//               CRC, transmisin UART del eUSCI_A0 y SPI del eUSCI_B0.
+//
+// El firmware accede a los registros a travs de SIM_reg8/16/32(), que
+// devuelven un puntero a una vista de la memoria de solo lectura. Una lectura
+// pasa sin ms; una escritura provoca SIGSEGV y SIM_fault() la marca antes de
+// habilitar la vista. Cada acceso entrega el anterior al modelo como lectura o
+// escritura segn esa marca, aunque la escritura repita el valor (un BIS sobre
+// un bit ya activo cuesta una escritura). As se modelan los bits con efectos
+// (ADCSC, TACLR, INTREFEN) y las lecturas que limpian banderas (ADCMEM0, ADCIV,
+// TAxIV, UCA0IV, UCB0IV).
+// Cada lectura cuesta SIM_READ_CYCLES y cada escritura SIM_WRITE_CYCLES; el
+// tiempo tambin avanza en __delay_cycles() y en LPM, y las interrupciones se
+// atienden entre accesos cuando GIE est activo.
+//
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "msp430.h"
+
+//*****************************************************************************
+//                              Definiciones
+//*****************************************************************************
+#define OFS_TAxCTL              0x00
+#define OFS_TAxCCTL0            0x02
+#define OFS_TAxR                0x10
+#define OFS_TAxCCR0             0x12
+#define OFS_TAxEX0              0x20
+#define OFS_TAxIV               0x2E
+
+#define SIM_MEMORY_SIZE         0x10000
+
+#define SIM_PORT_BASE(port)     (0x0200 + (((port) - 1) >> 1) * 0x0020 + (((port) - 1) & 0x01))
+
+//*****************************************************************************
+//                              Tipos
+//*****************************************************************************
+typedef struct SIM_timer
+{
+    const char* name;
+    uint16_t base;
+    uint16_t prescaler;                     // Flancos acumulados del divisor
+    uint8_t  down;                          // Sentido en modo up/down
+    uint8_t  out[3];                        // Salidas TAx.0-TAx.2
+} SIM_timer;
+
+//*****************************************************************************
+//                              Variables
+//*****************************************************************************
+uint8_t* SIM_memory;                        // Vista del modelo
+static uint8_t* io;                         // Vista del firmware, solo lectura
+static uint8_t shadow[SIM_MEMORY_SIZE];     // ltimo valor entregado al modelo
+
+static SIM_timer timers[2] =
+{
+    { "TA0", TIMER_A0_BASE },
+    { "TA1", TIMER_A1_BASE },
+};
+
+static struct
+{
+    uint64_t cycles;                        // Ciclos de MCLK desde el reset
+    SIM_counters counters;
+    uint64_t limit;
+    uint32_t aclkPhase;
+    uint16_t sr;
+    uint16_t stacked[SIM_NESTING];          // SR apilado por cada interrupcin
+    uint8_t  depth;
+    uint16_t lastAddress;                   // Acceso pendiente de entregar
+    uint8_t  lastWidth;
+    volatile sig_atomic_t written;          // El acceso pendiente escribi
+    volatile sig_atomic_t strayAddress;     // Escritura fuera del acceso pendiente
+    volatile sig_atomic_t stray;
+    uint16_t supplyMv;
+    uint16_t inputMv[16];
+    uint8_t  pinLevel[SIM_PORTS];
+    uint8_t  adcBusy;
+    uint8_t  adcChannel;                    // Canal en conversin
+    uint8_t  adcSequence;                   // Prximo canal de la secuencia
+    uint32_t adcRemaining;
+    uint32_t adcConversions;
+    uint32_t refRemaining;
+    uint16_t mpyOperand;
+    uint8_t  mpyMode;
+    uint8_t  accessWidth;                   // Bytes del acceso que se entrega
+    uint32_t uartRemaining;                 // Ciclos del carcter en curso
+    uint8_t  uartShift;                     // Carcter en curso
+    uint8_t  uartBuffered;                  // UCA0TXBUF espera al desplazamiento
+    uint32_t uartBytes;
+    uint32_t uartFrames;                    // Delimitadores 0x00 transmitidos
+    SIM_txHook uartHook;                    // SIM_onUartTx()
+    uint32_t spiRemaining;                  // Ciclos del byte en curso
+    uint8_t  spiShift;                      // Byte en curso
+    uint8_t  spiBuffered;                   // UCB0TXBUF espera al desplazamiento
+    uint32_t spiBytes;
+    SIM_txHook spiHook;                     // SIM_onSpiTx()
+} sim;
+
+//*****************************************************************************
+//                              Firmware
+//*****************************************************************************
+// Rutinas de interrupcin del firmware (nombres de la rama __GNUC__). Son
+// dbiles para que el modelo enlace aunque el firmware no defina alguna.
+extern void Timer_A(void) __attribute__((weak));
+extern void Timer_A1(void) __attribute__((weak));
+extern void ADC_ISR(void) __attribute__((weak));
+extern void USCI_A0_ISR(void) __attribute__((weak));
+extern void USCI_B0_ISR(void) __attribute__((weak));
+
+//*****************************************************************************
+//                              Prototipos
+//*****************************************************************************
+static void SIM_advance(uint32_t cycles);
+
+//*****************************************************************************
+static inline uint16_t SIM_peek16(const uint16_t address)
+{
+    return(*(uint16_t*)&SIM_memory[address]);
+}
+//*****************************************************************************
+static inline void SIM_poke16(const uint16_t address, const uint16_t value)
+{
+    *(uint16_t*)&SIM_memory[address] = value;
+    *(uint16_t*)&shadow[address] = value;
+}
+//*****************************************************************************
+static inline void SIM_set16(const uint16_t address, const uint16_t bits)
+{
+    SIM_poke16(address, SIM_peek16(address) | bits);
+}
+//*****************************************************************************
+static inline void SIM_clear16(const uint16_t address, const uint16_t bits)
+{
+    SIM_poke16(address, SIM_peek16(address) & ~bits);
+}
+//*****************************************************************************
+static uint32_t SIM_micros(void)
+{
+    return((uint32_t)(sim.cycles * 1000000UL / SIM_MCLK_HZ));
+}
+
+//*****************************************************************************
+//                              Puertos
+//*****************************************************************************
+static void SIM_gpioUpdate(void)
+{
+    uint16_t base;
+    uint8_t out, dir, ren;
+    uint8_t port;
+
+    for(port = 1; port <= SIM_PORTS; port++)
+    {
+        base = SIM_PORT_BASE(port);
+        out = SIM_memory[base + OFS_PAOUT];
+        dir = SIM_memory[base + OFS_PADIR];
+        ren = SIM_memory[base + OFS_PAREN];
+
+        // Salidas: el nivel del pin; entradas: nivel externo o resistencia
+        SIM_memory[base + OFS_PAIN] = (dir & out) | (~dir & ren & out) | (~dir & ~ren & sim.pinLevel[port - 1]);
+        shadow[base + OFS_PAIN] = SIM_memory[base + OFS_PAIN];
+    }
+}
+
+//*****************************************************************************
+//                              ADC
+//*****************************************************************************
+static void SIM_adcUpdateIV(void)
+{
+    static const uint16_t flags[] = { ADCOVIFG, ADCTOVIFG, ADCHIIFG, ADCLOIFG, ADCINIFG, ADCIFG0 };
+    uint16_t pending = SIM_peek16(0x071C) & SIM_peek16(0x071A);
+    uint8_t i;
+
+    for(i = 0; i < sizeof(flags) / sizeof(flags[0]); i++)
+    {
+        if(pending & flags[i])
+        {
+            SIM_poke16(0x071E, (i + 1) * 2);
+            return;
+        }
+    }
+    SIM_poke16(0x071E, ADCIV_NONE);
+}
+//*****************************************************************************
+static void SIM_adcStart(void)
+{
+    static const uint16_t sampleClocks[] = { 4, 8, 16, 32, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1024, 1024, 1024 };
+    uint16_t ctl0 = SIM_peek16(0x0700);
+    uint16_t ctl1 = SIM_peek16(0x0702);
+    uint16_t ctl2 = SIM_peek16(0x0704);
+    uint32_t clock, clocks, divider;
+
+    if(!(ctl0 & ADCON) || !(ctl0 & ADCENC))
+        return;
+
+    if(sim.adcBusy)
+    {
+        SIM_set16(0x071C, ADCTOVIFG);       // Disparo durante una conversin
+        SIM_adcUpdateIV();
+        return;
+    }
+
+    switch(ctl1 & 0x0018)
+    {
+        case ADCSSEL_0:  clock = SIM_MODOSC_HZ; break;
+        case ADCSSEL_1:  clock = SIM_ACLK_HZ;   break;
+        default:         clock = SIM_MCLK_HZ;   break;
+    }
+    divider = ((ctl1 >> 5) & 0x07) + 1;
+    divider *= ((ctl2 >> 8) & 0x03) == 0 ? 1 : (((ctl2 >> 8) & 0x03) == 1 ? 4 : 64);
+
+    clocks = (sampleClocks[(ctl0 & ADCSHT) >> 8] + ((ctl2 & ADCRES) ? 11 : 9)) * divider;
+
+    sim.adcChannel = (ctl1 & ADCCONSEQ_1) ? sim.adcSequence : (SIM_peek16(0x070A) & ADCINCH);
+    sim.adcRemaining = (clocks * SIM_MCLK_HZ + clock - 1) / clock;
+    sim.adcBusy = 1;
+    SIM_set16(0x0702, ADCBUSY);
+}
+//*****************************************************************************
+static uint16_t SIM_adcConvert(const uint8_t channel)
+{
+    uint16_t fullScale = (SIM_peek16(0x0704) & ADCRES) ? 1023 : 255;
+    uint32_t millivolts;
+    uint32_t result;
+
+    if(channel == 13)
+        millivolts = (SIM_peek16(0x0124) & REFGENRDY) ? SIM_VREF_MV : 0;
+    else if(channel < 10)
+        millivolts = sim.inputMv[channel];
+    else
+        millivolts = 0;
+
+    if(sim.supplyMv == 0)
+        return(0);
+
+    result = (millivolts * fullScale + sim.supplyMv / 2) / sim.supplyMv;
+    if(result > fullScale)
+        result = fullScale;
+
+    printf("%10lu us  ADC A%-2u %5lu mV -> %4lu\n", (unsigned long)SIM_micros(),
+           channel, (unsigned long)millivolts, (unsigned long)result);
+
+    return((uint16_t)result);
+}
+//*****************************************************************************
+static void SIM_adcComplete(void)
+{
+    uint16_t ctl1 = SIM_peek16(0x0702);
+    uint16_t result = SIM_adcConvert(sim.adcChannel);
+
+    sim.adcBusy = 0;
+    sim.adcConversions++;
+
+    if(SIM_peek16(0x071C) & ADCIFG0)
+        SIM_set16(0x071C, ADCOVIFG);        // ADCMEM0 sin leer
+    SIM_poke16(0x0712, result);
+    SIM_set16(0x071C, ADCIFG0);
+
+    // Comparador de ventana
+    if(result > SIM_peek16(0x0708))
+        SIM_set16(0x071C, ADCHIIFG);
+    else if(result < SIM_peek16(0x0706))
+        SIM_set16(0x071C, ADCLOIFG);
+    else
+        SIM_set16(0x071C, ADCINIFG);
+
+    SIM_clear16(0x0700, ADCSC);
+    SIM_clear16(0x0702, ADCBUSY);
+
+    // Secuencia de canales: del canal de ADCMCTL0 hasta A0
+    if(ctl1 & ADCCONSEQ_1)
+        sim.adcSequence = (sim.adcChannel == 0) ? (SIM_peek16(0x070A) & ADCINCH) : sim.adcChannel - 1;
+
+    SIM_adcUpdateIV();
+
+    // Conversiones mltiples sin nuevo disparo
+    if((SIM_peek16(0x0700) & ADCMSC) && (ctl1 & ADCCONSEQ) && !(ctl1 & ADCSHS)
+       && !((ctl1 & ADCCONSEQ) == ADCCONSEQ_1 && sim.adcChannel == 0))
+        SIM_adcStart();
+}
+//*****************************************************************************
+static void SIM_adcWrite(const uint16_t address, const uint16_t old, const uint16_t value)
+{
+    switch(address)
+    {
+        case 0x0700:                        // ADCCTL0
+            if(!(value & ADCON))
+            {
+                sim.adcBusy = 0;
+                SIM_clear16(0x0702, ADCBUSY);
+            }
+            if((value & ADCENC) && !(old & ADCENC))
+                sim.adcSequence = SIM_peek16(0x070A) & ADCINCH;
+            if((value & ADCSC) && !(SIM_peek16(0x0702) & ADCSHS))
+                SIM_adcStart();
+            break;
+        case 0x0712:                        // ADCMEM0, solo lectura
+        case 0x071E:                        // ADCIV, solo lectura
+            SIM_poke16(address, old);
+            break;
+        case 0x071A:                        // ADCIE
+        case 0x071C:                        // ADCIFG
+            SIM_adcUpdateIV();
+            break;
+        default:
+            break;
+    }
+}
+//*****************************************************************************
+static void SIM_adcRead(const uint16_t address)
+{
+    static const uint16_t flags[] = { 0, ADCOVIFG, ADCTOVIFG, ADCHIIFG, ADCLOIFG, ADCINIFG, ADCIFG0 };
+    uint16_t vector;
+
+    switch(address)
+    {
+        case 0x0712:                        // ADCMEM0 limpia ADCIFG0
+            SIM_clear16(0x071C, ADCIFG0);
+            SIM_adcUpdateIV();
+            break;
+        case 0x071E:                        // ADCIV limpia la bandera indicada
+            vector = SIM_peek16(0x071E);
+            if(vector)
+            {
+                SIM_clear16(0x071C, flags[vector / 2]);
+                SIM_adcUpdateIV();
+            }
+            break;
+        default:
+            break;
+    }
+}
+//*****************************************************************************
+static void SIM_adcTick(void)
+{
+    if(sim.adcBusy && --sim.adcRemaining == 0)
+        SIM_adcComplete();
+}
+
+//*****************************************************************************
+//                              Timer_A
+//*****************************************************************************
+static void SIM_timerUpdateIV(SIM_timer* timer)
+{
+    uint16_t base = timer->base;
+
+    if((SIM_peek16(base + OFS_TAxCCTL0 + 2) & (CCIE | CCIFG)) == (CCIE | CCIFG))
+        SIM_poke16(base + OFS_TAxIV, TA0IV_TACCR1);
+    else if((SIM_peek16(base + OFS_TAxCCTL0 + 4) & (CCIE | CCIFG)) == (CCIE | CCIFG))
+        SIM_poke16(base + OFS_TAxIV, TA0IV_TACCR2);
+    else if((SIM_peek16(base + OFS_TAxCTL) & (TAIE | TAIFG)) == (TAIE | TAIFG))
+        SIM_poke16(base + OFS_TAxIV, TA0IV_TAIFG);
+    else
+        SIM_poke16(base + OFS_TAxIV, TA0IV_NONE);
+}
+//*****************************************************************************
+static void SIM_timerOutput(SIM_timer* timer, const uint8_t channel, const uint8_t level)
+{
+    uint16_t shs = SIM_peek16(0x0702) & ADCSHS;
+
+    if(level && !timer->out[channel] && timer == &timers[1]
+       && ((shs == ADCSHS_1 && channel == 1) || (shs == ADCSHS_2 && channel == 2)))
+        SIM_adcStart();                     // Flanco ascendente de TA1.xB
+
+    timer->out[channel] = level;
+}
+//*****************************************************************************
+static void SIM_timerCompare(SIM_timer* timer, const uint8_t channel)
+{
+    uint16_t base = timer->base;
+    uint8_t mode;
+    uint8_t n;
+
+    SIM_set16(base + OFS_TAxCCTL0 + 2 * channel, CCIFG);
+
+    mode = (SIM_peek16(base + OFS_TAxCCTL0 + 2 * channel) & OUTMOD) >> 5;
+    switch(mode)
+    {
+        case 1: case 3:           SIM_timerOutput(timer, channel, 1); break;
+        case 2: case 4: case 6:   SIM_timerOutput(timer, channel, !timer->out[channel]); break;
+        case 5: case 7:           SIM_timerOutput(timer, channel, 0); break;
+        default: break;
+    }
+
+    // La comparacin con CCR0 completa los modos x/set y x/reset
+    if(channel == 0)
+    {
+        for(n = 1; n < 3; n++)
+        {
+            mode = (SIM_peek16(base + OFS_TAxCCTL0 + 2 * n) & OUTMOD) >> 5;
+            if(mode == 2 || mode == 3)
+                SIM_timerOutput(timer, n, 0);
+            else if(mode == 6 || mode == 7)
+                SIM_timerOutput(timer, n, 1);
+        }
+    }
+}
+//*****************************************************************************
+static void SIM_timerTick(SIM_timer* timer, const uint8_t aclk, const uint8_t smclk)
+{
+    uint16_t base = timer->base;
+    uint16_t ctl = SIM_peek16(base + OFS_TAxCTL);
+    uint16_t ccr0 = SIM_peek16(base + OFS_TAxCCR0);
+    uint16_t divider;
+    uint16_t count;
+    uint8_t n;
+
+    if(!(ctl & MC))
+        return;
+
+    switch(ctl & TASSEL)
+    {
+        case TASSEL__ACLK:  if(!aclk) return; break;
+        case TASSEL__SMCLK: if(!smclk) return; break;
+        default:            return;     // TAxCLK e INCLK no se modelan
+    }
+
+    divider = (1 << ((ctl & ID) >> 6)) * ((SIM_peek16(base + OFS_TAxEX0) & TAIDEX) + 1);
+    if(++timer->prescaler < divider)
+        return;
+    timer->prescaler = 0;
+
+    count = SIM_peek16(base + OFS_TAxR);
+    switch(ctl & MC)
+    {
+        case MC_1:                          // Up
+            if(count >= ccr0)
+            {
+                count = 0;
+                SIM_set16(base + OFS_TAxCTL, TAIFG);
+            }
+            else
+                count++;
+            break;
+        case MC_2:                          // Continuous
+            if(++count == 0)
+                SIM_set16(base + OFS_TAxCTL, TAIFG);
+            break;
+        default:                            // Up/down
+            if(!timer->down && count >= ccr0)
+                timer->down = 1;
+            else if(timer->down && count == 0)
+            {
+                timer->down = 0;
+                SIM_set16(base + OFS_TAxCTL, TAIFG);
+            }
+            count = timer->down ? count - 1 : count + 1;
+            break;
+    }
+    SIM_poke16(base + OFS_TAxR, count);
+
+    for(n = 0; n < 3; n++)
+        if(count == SIM_peek16(base + OFS_TAxCCR0 + 2 * n))
+            SIM_timerCompare(timer, n);
+
+    SIM_timerUpdateIV(timer);
+}
+//*****************************************************************************
+static void SIM_timerWrite(SIM_timer* timer, const uint16_t offset, const uint16_t value)
+{
+    if(offset == OFS_TAxCTL && (value & TACLR))
+    {
+        // TACLR: contador, divisor y sentido a cero; el bit se lee siempre 0
+        SIM_poke16(timer->base + OFS_TAxCTL, value & ~TACLR);
+        SIM_poke16(timer->base + OFS_TAxR, 0);
+        timer->prescaler = 0;
+        timer->down = 0;
+    }
+    SIM_timerUpdateIV(timer);
+}
+//*****************************************************************************
+static void SIM_timerRead(SIM_timer* timer, const uint16_t offset)
+{
+    uint16_t base = timer->base;
+
+    if(offset != OFS_TAxIV)
+        return;
+
+    // TAxIV limpia la bandera de mayor prioridad
+    switch(SIM_peek16(base + OFS_TAxIV))
+    {
+        case TA0IV_TACCR1: SIM_clear16(base + OFS_TAxCCTL0 + 2, CCIFG); break;
+        case TA0IV_TACCR2: SIM_clear16(base + OFS_TAxCCTL0 + 4, CCIFG); break;
+        case TA0IV_TAIFG:  SIM_clear16(base + OFS_TAxCTL, TAIFG);       break;
+        default: break;
+    }
+    SIM_timerUpdateIV(timer);
+}
+
+//*****************************************************************************
+//                              PMM
+//*****************************************************************************
+static void SIM_pmmWrite(const uint16_t address, const uint16_t old, const uint16_t value)
+{
+    if(address != 0x0124)
+        return;
+
+    // PMMCTL2 solo se escribe con PMMCTL0 desbloqueado
+    if(SIM_memory[0x0121] != PMMPW_H)
+    {
+        SIM_poke16(address, old);
+        return;
+    }
+
+    // REFGENRDY lo maneja el modelo
+    SIM_poke16(address, (value & ~REFGENRDY) | (old & REFGENRDY));
+    if((value & INTREFEN) && !(old & INTREFEN))
+        sim.refRemaining = SIM_REF_SETTLE_CYCLES;
+    else if(!(value & INTREFEN))
+    {
+        sim.refRemaining = 0;
+        SIM_clear16(address, REFGENRDY);
+    }
+}
+//*****************************************************************************
+static void SIM_pmmTick(void)
+{
+    if(sim.refRemaining && --sim.refRemaining == 0)
+        SIM_set16(0x0124, REFGENRDY);
+}
+
+//*****************************************************************************
+//                              MPY32
+//*****************************************************************************
+static void SIM_mpyWrite(const uint16_t offset, const uint16_t value)
+{
+    uint16_t ctl = SIM_peek16(MPY32_BASE + OFS_MPY32CTL0);
+    int64_t product;
+    int64_t sum;
+
+    switch(offset)
+    {
+        case OFS_MPY:
+        case OFS_MPYS:
+        case OFS_MAC:
+        case OFS_MACS:
+            sim.mpyOperand = value;
+            sim.mpyMode = offset;
+            return;
+        case OFS_RESLO:
+        case OFS_RESHI:
+            SIM_poke16(MPY32_BASE + OFS_RES0 + offset - OFS_RESLO, value);
+            return;
+        case OFS_RES0:
+        case OFS_RES1:
+            SIM_poke16(MPY32_BASE + OFS_RESLO + offset - OFS_RES0, value);
+            return;
+        case OFS_OP2:
+            break;
+        default:
+            return;
+    }
+
+    // La escritura de OP2 inicia la operacin de 16 x 16 bits
+    if(sim.mpyMode == OFS_MPYS || sim.mpyMode == OFS_MACS)
+        product = (int64_t)(int16_t)sim.mpyOperand * (int16_t)value;
+    else
+        product = (int64_t)sim.mpyOperand * value;
+
+    sum = product;
+    if(sim.mpyMode == OFS_MAC)
+        sum += (uint32_t)(SIM_peek16(MPY32_BASE + OFS_RES0) | ((uint32_t)SIM_peek16(MPY32_BASE + OFS_RES1) << 16));
+    else if(sim.mpyMode == OFS_MACS)
+        sum += (int32_t)(SIM_peek16(MPY32_BASE + OFS_RES0) | ((uint32_t)SIM_peek16(MPY32_BASE + OFS_RES1) << 16));
+
+    if(sim.mpyMode == OFS_MPYS || sim.mpyMode == OFS_MACS)
+    {
+        SIM_poke16(MPY32_BASE + OFS_SUMEXT, (sum < 0) ? 0xFFFF : 0x0000);
+        if(ctl & MPYSAT)
+            sum = (sum > INT32_MAX) ? INT32_MAX : ((sum < INT32_MIN) ? INT32_MIN : sum);
+    }
+    else
+        SIM_poke16(MPY32_BASE + OFS_SUMEXT, (sum >> 32) ? 0x0001 : 0x0000);
+
+    SIM_poke16(MPY32_BASE + OFS_RES0, (uint16_t)sum);
+    SIM_poke16(MPY32_BASE + OFS_RES1, (uint16_t)(sum >> 16));
+    SIM_poke16(MPY32_BASE + OFS_RESLO, (uint16_t)sum);
+    SIM_poke16(MPY32_BASE + OFS_RESHI, (uint16_t)(sum >> 16));
+}
+
+//*****************************************************************************
+//                              eUSCI_A0
+//*****************************************************************************
+static void SIM_uartUpdateIV(void)
+{
+    static const uint16_t flags[] = { UCRXIFG, UCTXIFG, UCSTTIFG, UCTXCPTIFG };
+    uint16_t pending = SIM_peek16(EUSCI_A0_BASE + OFS_UCAxIFG) & SIM_peek16(EUSCI_A0_BASE + OFS_UCAxIE);
+    uint16_t iv = USCI_NONE;
+    uint8_t i;
+
+    for(i = 0; i < 4; i++)
+        if(pending & flags[i])
+        {
+            iv = (i + 1) * 2;
+            break;
+        }
+
+    SIM_poke16(EUSCI_A0_BASE + OFS_UCAxIV, iv);
+}
+//*****************************************************************************
+static void SIM_uartLoad(const uint8_t data)
+{
+    uint16_t ctl = SIM_peek16(EUSCI_A0_BASE + OFS_UCAxCTLW0);
+    uint16_t mctl = SIM_peek16(EUSCI_A0_BASE + OFS_UCAxMCTLW);
+    uint32_t bit = SIM_peek16(EUSCI_A0_BASE + OFS_UCAxBRW);
+    uint8_t bits = 10;
+
+    if(mctl & UCOS16)
+        bit = 16 * bit + ((mctl >> 4) & 0x0F);
+    if((ctl & UCSSEL_3) == UCSSEL__ACLK)
+        bit = bit * SIM_MCLK_HZ / SIM_ACLK_HZ;
+    if(bit == 0)
+        bit = 1;
+    if(ctl & UCSPB)
+        bits++;
+    if(ctl & UCPEN)
+        bits++;
+    if(ctl & UC7BIT)
+        bits--;
+
+    sim.uartShift = data;
+    sim.uartRemaining = bit * bits;
+    SIM_set16(EUSCI_A0_BASE + OFS_UCAxSTATW, UCBUSY);
+    SIM_set16(EUSCI_A0_BASE + OFS_UCAxIFG, UCTXIFG);
+}
+//*****************************************************************************
+static void SIM_uartWrite(const uint16_t offset, const uint16_t old, const uint16_t value)
+{
+    switch(offset)
+    {
+        case OFS_UCAxCTLW0:
+            if((value & UCSWRST) && !(old & UCSWRST))
+            {
+                // Reset: se corta el carcter en curso
+                sim.uartRemaining = 0;
+                sim.uartBuffered = 0;
+                SIM_poke16(EUSCI_A0_BASE + OFS_UCAxIE, 0);
+                SIM_poke16(EUSCI_A0_BASE + OFS_UCAxIFG, 0);
+                SIM_poke16(EUSCI_A0_BASE + OFS_UCAxSTATW, 0);
+            }
+            else if(!(value & UCSWRST) && (old & UCSWRST))
+                SIM_set16(EUSCI_A0_BASE + OFS_UCAxIFG, UCTXIFG);
+            break;
+        case OFS_UCAxTXBUF:
+            if(SIM_peek16(EUSCI_A0_BASE + OFS_UCAxCTLW0) & UCSWRST)
+                break;
+            SIM_clear16(EUSCI_A0_BASE + OFS_UCAxIFG, UCTXIFG | UCTXCPTIFG);
+            if(sim.uartRemaining)
+                sim.uartBuffered = 1;
+            else
+                SIM_uartLoad((uint8_t)value);
+            break;
+        case OFS_UCAxIV:                    // Solo lectura
+            break;
+        default:
+            break;
+    }
+
+    SIM_uartUpdateIV();
+}
+//*****************************************************************************
+static void SIM_uartRead(const uint16_t offset)
+{
+    static const uint16_t flags[] = { 0, UCRXIFG, UCTXIFG, UCSTTIFG, UCTXCPTIFG };
+    uint16_t iv;
+
+    if(offset != OFS_UCAxIV)
+        return;
+
+    // UCAxIV limpia la bandera indicada
+    iv = SIM_peek16(EUSCI_A0_BASE + OFS_UCAxIV);
+    if(iv && iv <= USCI_UART_UCTXCPTIFG)
+        SIM_clear16(EUSCI_A0_BASE + OFS_UCAxIFG, flags[iv / 2]);
+    SIM_uartUpdateIV();
+}
+//*****************************************************************************
+static void SIM_uartTick(void)
+{
+    if(sim.uartRemaining == 0 || --sim.uartRemaining)
+        return;
+
+    sim.uartBytes++;
+    if(sim.uartShift == 0x00)
+        sim.uartFrames++;
+    if(sim.uartHook)
+        sim.uartHook(sim.uartShift);
+
+    if(sim.uartBuffered)
+    {
+        sim.uartBuffered = 0;
+        SIM_uartLoad((uint8_t)SIM_peek16(EUSCI_A0_BASE + OFS_UCAxTXBUF));
+    }
+    else
+    {
+        SIM_clear16(EUSCI_A0_BASE + OFS_UCAxSTATW, UCBUSY);
+        SIM_set16(EUSCI_A0_BASE + OFS_UCAxIFG, UCTXCPTIFG);
+    }
+
+    SIM_uartUpdateIV();
+}
+
+//*****************************************************************************
+//                              eUSCI_B0
+//*****************************************************************************
+static void SIM_spiUpdateIV(void)
+{
+    uint16_t pending = SIM_peek16(EUSCI_B0_BASE + OFS_UCBxIFG) & SIM_peek16(EUSCI_B0_BASE + OFS_UCBxIE);
+
+    SIM_poke16(EUSCI_B0_BASE + OFS_UCBxIV, (pending & UCTXIFG) ? USCI_SPI_UCTXIFG : USCI_NONE);
+}
+//*****************************************************************************
+static void SIM_spiLoad(const uint8_t data)
+{
+    uint16_t ctl = SIM_peek16(EUSCI_B0_BASE + OFS_UCBxCTLW0);
+    uint32_t bit = SIM_peek16(EUSCI_B0_BASE + OFS_UCBxBRW);
+
+    if((ctl & UCSSEL_3) == UCSSEL__ACLK)
+        bit = bit * SIM_MCLK_HZ / SIM_ACLK_HZ;
+    if(bit == 0)
+        bit = 1;
+
+    sim.spiShift = data;
+    sim.spiRemaining = 8 * bit;
+    SIM_set16(EUSCI_B0_BASE + OFS_UCBxSTATW, UCBUSY);
+    SIM_set16(EUSCI_B0_BASE + OFS_UCBxIFG, UCTXIFG);
+}
+//*****************************************************************************
+static void SIM_spiWrite(const uint16_t offset, const uint16_t old, const uint16_t value)
+{
+    switch(offset)
+    {
+        case OFS_UCBxCTLW0:
+            if((value & UCSWRST) && !(old & UCSWRST))
+            {
+                // Reset: se corta el byte en curso
+                sim.spiRemaining = 0;
+                sim.spiBuffered = 0;
+                SIM_poke16(EUSCI_B0_BASE + OFS_UCBxIE, 0);
+                SIM_poke16(EUSCI_B0_BASE + OFS_UCBxIFG, 0);
+                SIM_poke16(EUSCI_B0_BASE + OFS_UCBxSTATW, 0);
+            }
+            else if(!(value & UCSWRST) && (old & UCSWRST))
+                SIM_set16(EUSCI_B0_BASE + OFS_UCBxIFG, UCTXIFG);
+            break;
+        case OFS_UCBxTXBUF:
+            if(SIM_peek16(EUSCI_B0_BASE + OFS_UCBxCTLW0) & UCSWRST)
+                break;
+            SIM_clear16(EUSCI_B0_BASE + OFS_UCBxIFG, UCTXIFG);
+            if(sim.spiRemaining)
+                sim.spiBuffered = 1;
+            else
+                SIM_spiLoad((uint8_t)value);
+            break;
+        default:
+            break;
+    }
+
+    SIM_spiUpdateIV();
+}
+//*****************************************************************************
+static void SIM_spiRead(const uint16_t offset)
+{
+    if(offset != OFS_UCBxIV)
+        return;
+
+    // UCBxIV limpia la bandera indicada
+    if(SIM_peek16(EUSCI_B0_BASE + OFS_UCBxIV) == USCI_SPI_UCTXIFG)
+        SIM_clear16(EUSCI_B0_BASE + OFS_UCBxIFG, UCTXIFG);
+    SIM_spiUpdateIV();
+}
+//*****************************************************************************
+static void SIM_spiTick(void)
+{
+    if(sim.spiRemaining == 0 || --sim.spiRemaining)
+        return;
+
+    sim.spiBytes++;
+    if(sim.spiHook)
+        sim.spiHook(sim.spiShift);
+
+    if(sim.spiBuffered)
+    {
+        sim.spiBuffered = 0;
+        SIM_spiLoad((uint8_t)SIM_peek16(EUSCI_B0_BASE + OFS_UCBxTXBUF));
+    }
+    else
+        SIM_clear16(EUSCI_B0_BASE + OFS_UCBxSTATW, UCBUSY);
+
+    SIM_spiUpdateIV();
+}
+
+//*****************************************************************************
+//                              CRC
+//*****************************************************************************
+static void SIM_crcByte(uint8_t data)
+{
+    uint16_t crc = SIM_peek16(CRC_BASE + OFS_CRCINIRES);
+    uint8_t bit;
+
+    // CRCDI entra desde el bit 0 de cada byte
+    for(bit = 0; bit < 8; bit++, data >>= 1)
+        crc = ((crc >> 15) ^ (data & 1)) ? (uint16_t)(crc << 1) ^ 0x1021 : (uint16_t)(crc << 1);
+
+    SIM_poke16(CRC_BASE + OFS_CRCINIRES, crc);
+}
+//*****************************************************************************
+static void SIM_crcWrite(const uint16_t offset, const uint16_t value)
+{
+    uint16_t crc;
+    uint16_t reversed = 0;
+    uint8_t bit;
+
+    switch(offset)
+    {
+        case OFS_CRCDI:                     // Byte bajo primero
+            SIM_crcByte((uint8_t)value);
+            if(sim.accessWidth > 1)
+                SIM_crcByte((uint8_t)(value >> 8));
+            break;
+        case OFS_CRCINIRES:                 // Semilla
+            break;
+        default:
+            return;
+    }
+
+    crc = SIM_peek16(CRC_BASE + OFS_CRCINIRES);
+    for(bit = 0; bit < 16; bit++, crc >>= 1)
+        reversed = (reversed << 1) | (crc & 1);
+    SIM_poke16(CRC_BASE + OFS_CRCRESR, reversed);
+}
+
+//*****************************************************************************
+//                              Bus
+//*****************************************************************************
+static void SIM_write(const uint16_t address, const uint16_t old, const uint16_t value)
+{
+    if(address >= 0x0700 && address < 0x0720)
+        SIM_adcWrite(address, old, value);
+    else if(address >= TIMER_A0_BASE && address < TIMER_A0_BASE + 0x30)
+        SIM_timerWrite(&timers[0], address - TIMER_A0_BASE, value);
+    else if(address >= TIMER_A1_BASE && address < TIMER_A1_BASE + 0x30)
+        SIM_timerWrite(&timers[1], address - TIMER_A1_BASE, value);
+    else if(address >= 0x0200 && address < 0x0280)
+        SIM_gpioUpdate();
+    else if(address >= 0x0120 && address < 0x0130)
+        SIM_pmmWrite(address, old, value);
+    else if(address >= MPY32_BASE && address < MPY32_BASE + 0x30)
+        SIM_mpyWrite(address - MPY32_BASE, value);
+    else if(address >= CRC_BASE && address < CRC_BASE + 0x08)
+        SIM_crcWrite(address - CRC_BASE, value);
+    else if(address >= EUSCI_A0_BASE && address < EUSCI_A0_BASE + 0x20)
+        SIM_uartWrite(address - EUSCI_A0_BASE, old, value);
+    else if(address >= EUSCI_B0_BASE && address < EUSCI_B0_BASE + 0x30)
+        SIM_spiWrite(address - EUSCI_B0_BASE, old, value);
+    else if(address == WDT_A_BASE)
+    {
+        if((value & 0xFF00) != WDTPW)
+            SIM_finish("PUC: WDTCTL written without password", SIM_EXIT_FAULT);
+        SIM_poke16(address, 0x6900 | (value & 0x00FF & ~WDTCNTCL));
+    }
+}
+//*****************************************************************************
+static void SIM_read(const uint16_t address)
+{
+    if(address >= 0x0700 && address < 0x0720)
+        SIM_adcRead(address);
+    else if(address >= TIMER_A0_BASE && address < TIMER_A0_BASE + 0x30)
+        SIM_timerRead(&timers[0], address - TIMER_A0_BASE);
+    else if(address >= TIMER_A1_BASE && address < TIMER_A1_BASE + 0x30)
+        SIM_timerRead(&timers[1], address - TIMER_A1_BASE);
+    else if(address >= EUSCI_A0_BASE && address < EUSCI_A0_BASE + 0x20)
+        SIM_uartRead(address - EUSCI_A0_BASE);
+    else if(address >= EUSCI_B0_BASE && address < EUSCI_B0_BASE + 0x30)
+        SIM_spiRead(address - EUSCI_B0_BASE);
+}
+//*****************************************************************************
+static void SIM_deliver(const uint16_t address, const uint8_t write)
+{
+    uint16_t old = *(uint16_t*)&shadow[address];
+    uint16_t value = SIM_peek16(address);
+
+    *(uint16_t*)&shadow[address] = value;
+    if(write)
+        SIM_write(address, old, value);
+    else
+        SIM_read(address);
+}
+//*****************************************************************************
+static void SIM_commit(void)
+{
+    uint16_t address;
+    uint32_t end;
+    uint8_t written = sim.written;
+
+    if(written || sim.stray)
+    {
+        sim.written = 0;
+        mprotect(io, SIM_MEMORY_SIZE, PROT_READ);
+    }
+
+    // Escritura por un puntero de un acceso anterior (por ejemplo
+    // HWREG16(a) = HWREG16(b) con las llamadas en otro orden)
+    if(sim.stray)
+    {
+        sim.stray = 0;
+        SIM_deliver((uint16_t)sim.strayAddress, 1);
+        sim.counters.writes++;
+        SIM_advance(SIM_WRITE_CYCLES);
+    }
+
+    if(sim.lastWidth == 0)
+        return;
+
+    end = (uint32_t)sim.lastAddress + sim.lastWidth;
+    sim.accessWidth = sim.lastWidth;
+    sim.lastWidth = 0;
+
+    for(address = sim.lastAddress & ~1; address < end; address += 2)
+        SIM_deliver(address, written);
+
+    // Costo del acceso, una vez aplicados sus efectos
+    if(written)
+    {
+        sim.counters.writes++;
+        SIM_advance(SIM_WRITE_CYCLES);
+    }
+    else
+    {
+        sim.counters.reads++;
+        SIM_advance(SIM_READ_CYCLES);
+    }
+}
+//*****************************************************************************
+static volatile uint8_t* SIM_access(const uint16_t address, const uint8_t width)
+{
+    SIM_commit();
+
+    sim.lastAddress = address;
+    sim.lastWidth = width;
+
+    return(&io[address]);
+}
+//*****************************************************************************
+volatile uint8_t* SIM_reg8(const uint16_t address)
+{
+    return(SIM_access(address, 1));
+}
+//*****************************************************************************
+volatile uint16_t* SIM_reg16(const uint16_t address)
+{
+    return((volatile uint16_t*)SIM_access(address & ~1, 2));
+}
+//*****************************************************************************
+volatile uint32_t* SIM_reg32(const uint16_t address)
+{
+    return((volatile uint32_t*)SIM_access(address & ~1, 4));
+}
+
+//*****************************************************************************
+//                              CPU
+//*****************************************************************************
+static void SIM_call(void (*isr)(void))
+{
+    sim.stacked[sim.depth++] = sim.sr;
+    sim.sr &= SCG0;                         // GIE y bits de LPM a cero
+    SIM_advance(SIM_ISR_CYCLES);
+
+    isr();
+
+    SIM_commit();
+    sim.sr = sim.stacked[--sim.depth];
+}
+//*****************************************************************************
+static void (*SIM_pending(void))(void)
+{
+    // Prioridad de los vectores del MSP430FR4133
+    if((SIM_peek16(TIMER_A0_BASE + OFS_TAxCCTL0) & (CCIE | CCIFG)) == (CCIE | CCIFG) && Timer_A)
+    {
+        SIM_clear16(TIMER_A0_BASE + OFS_TAxCCTL0, CCIFG);
+        return(Timer_A);
+    }
+    if(SIM_peek16(TIMER_A0_BASE + OFS_TAxIV) != TA0IV_NONE && Timer_A1)
+        return(Timer_A1);
+    if(SIM_peek16(EUSCI_A0_BASE + OFS_UCAxIV) != USCI_NONE && USCI_A0_ISR)
+        return(USCI_A0_ISR);
+    if(SIM_peek16(EUSCI_B0_BASE + OFS_UCBxIV) != USCI_NONE && USCI_B0_ISR)
+        return(USCI_B0_ISR);
+    if(SIM_peek16(0x071E) != ADCIV_NONE && ADC_ISR)
+        return(ADC_ISR);
+
+    return(NULL);
+}
+//*****************************************************************************
+static void SIM_dispatch(void)
+{
+    void (*isr)(void);
+
+    while((sim.sr & GIE) && sim.depth < SIM_NESTING)
+    {
+        isr = SIM_pending();
+        if(isr == NULL)
+            return;
+        SIM_call(isr);
+    }
+}
+//*****************************************************************************
+static void SIM_tick(void)
+{
+    uint8_t aclk = 0;
+
+    sim.cycles++;
+    if(sim.sr & CPUOFF)
+        sim.counters.lpmCycles++;
+    else
+        sim.counters.activeCycles++;
+
+    sim.aclkPhase += SIM_ACLK_HZ;
+    if(sim.aclkPhase >= SIM_MCLK_HZ)
+    {
+        sim.aclkPhase -= SIM_MCLK_HZ;
+        aclk = 1;
+    }
+
+    // SMCLK se detiene en LPM3 (SCG1), sigue en LPM0
+    SIM_timerTick(&timers[0], aclk, !(sim.sr & SCG1));
+    SIM_timerTick(&timers[1], aclk, !(sim.sr & SCG1));
+    SIM_pmmTick();
+    SIM_adcTick();
+    SIM_uartTick();
+    SIM_spiTick();
+
+    if(sim.cycles >= sim.limit)
+        SIM_finish("time limit reached", SIM_EXIT_TIMEOUT);
+}
+//*****************************************************************************
+static void SIM_advance(uint32_t cycles)
+{
+    while(cycles--)
+    {
+        SIM_tick();
+        SIM_dispatch();
+    }
+}
+//*****************************************************************************
+static uint8_t SIM_canWake(void)
+{
+    uint8_t i;
+    uint16_t ctl;
+
+    if(!(sim.sr & GIE))
+        return(0);
+    if(sim.adcBusy || sim.refRemaining)
+        return(1);
+    if(sim.uartRemaining && (SIM_peek16(EUSCI_A0_BASE + OFS_UCAxIE) & (UCTXIE | UCTXCPTIE)))
+        return(1);
+    if(sim.spiRemaining && (SIM_peek16(EUSCI_B0_BASE + OFS_UCBxIE) & UCTXIE))
+        return(1);
+    for(i = 0; i < 2; i++)
+    {
+        // Un timer en marcha despierta si interrumpe o si dispara el ADC
+        ctl = SIM_peek16(timers[i].base + OFS_TAxCTL);
+        if(!(ctl & MC) || ((ctl & TASSEL) != TASSEL__ACLK && (ctl & TASSEL) != TASSEL__SMCLK))
+            continue;
+        if((ctl & TASSEL) == TASSEL__SMCLK && (sim.sr & SCG1))
+            continue;                       // Sin SMCLK en LPM3
+        if((ctl & TAIE) || (SIM_peek16(0x0702) & ADCSHS)
+           || ((SIM_peek16(timers[i].base + OFS_TAxCCTL0) | SIM_peek16(timers[i].base + OFS_TAxCCTL0 + 2)
+                | SIM_peek16(timers[i].base + OFS_TAxCCTL0 + 4)) & CCIE))
+            return(1);
+    }
+    return(0);
+}
+//*****************************************************************************
+void SIM_bisSR(const uint16_t bits)
+{
+    SIM_commit();
+    sim.sr |= bits;
+    SIM_dispatch();
+
+    while(sim.sr & CPUOFF)
+    {
+        if(!SIM_canWake())
+            SIM_finish("LPM with no wake-up source", SIM_EXIT_IDLE);
+        SIM_advance(1);
+    }
+}
+//*****************************************************************************
+void SIM_bicSR(const uint16_t bits)
+{
+    SIM_commit();
+    sim.sr &= ~bits;
+}
+//*****************************************************************************
+void SIM_bisSROnExit(const uint16_t bits)
+{
+    if(sim.depth)
+        sim.stacked[sim.depth - 1] |= bits;
+}
+//*****************************************************************************
+void SIM_bicSROnExit(const uint16_t bits)
+{
+    if(sim.depth)
+        sim.stacked[sim.depth - 1] &= ~bits;
+}
+//*****************************************************************************
+uint16_t SIM_getSR(void)
+{
+    return(sim.sr);
+}
+//*****************************************************************************
+void SIM_delayCycles(const uint32_t cycles)
+{
+    SIM_commit();
+    SIM_advance(cycles);
+}
+//*****************************************************************************
+int32_t SIM_multiply(const int32_t a, const int32_t b)
+{
+    uint32_t multiplier = b < 0 ? -(uint32_t)b : (uint32_t)b;
+    uint32_t cycles = SIM_CALL_CYCLES + SIM_MUL_CYCLES;
+
+    for(; multiplier; multiplier >>= 1)
+        cycles += SIM_MUL_BIT_CYCLES;
+
+    SIM_commit();
+    SIM_advance(cycles);
+
+    return((int32_t)((uint32_t)a * (uint32_t)b));
+}
+
+//*****************************************************************************
+//                              Control
+//*****************************************************************************
+static void SIM_fault(int signal, siginfo_t* info, void* context)
+{
+    uint8_t* address = (uint8_t*)info->si_addr;
+    uint16_t offset;
+
+    if(address < io || address >= io + SIM_MEMORY_SIZE)
+    {
+        // Falla del programa: se repite con el tratamiento por defecto
+        sigaction(SIGSEGV, &(struct sigaction){ .sa_handler = SIG_DFL }, NULL);
+        return;
+    }
+
+    offset = (uint16_t)(address - io);
+    if(sim.lastWidth && offset >= sim.lastAddress && offset < sim.lastAddress + sim.lastWidth)
+        sim.written = 1;
+    else
+    {
+        sim.strayAddress = offset & ~1;
+        sim.stray = 1;
+    }
+
+    // La instruccin se repite con la vista habilitada hasta el prximo acceso
+    mprotect(io, SIM_MEMORY_SIZE, PROT_READ | PROT_WRITE);
+}
+//*****************************************************************************
+static void SIM_map(void)
+{
+    struct sigaction action = { .sa_sigaction = SIM_fault, .sa_flags = SA_SIGINFO };
+    char name[] = "/tmp/msp430XXXXXX";
+    int fd = mkstemp(name);
+
+    // Dos vistas del mismo archivo: el modelo escribe sin trampas
+    if(fd < 0 || unlink(name) < 0 || ftruncate(fd, SIM_MEMORY_SIZE) < 0)
+    {
+        perror(name);
+        exit(EXIT_FAILURE);
+    }
+    SIM_memory = mmap(NULL, SIM_MEMORY_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    io = mmap(NULL, SIM_MEMORY_SIZE, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(SIM_memory == MAP_FAILED || io == MAP_FAILED)
+    {
+        perror("mmap");
+        exit(EXIT_FAILURE);
+    }
+
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGSEGV, &action, NULL);
+}
+//*****************************************************************************
+void SIM_reset(void)
+{
+    if(SIM_memory == NULL)
+        SIM_map();
+    mprotect(io, SIM_MEMORY_SIZE, PROT_READ);
+
+    memset(SIM_memory, 0, SIM_MEMORY_SIZE);
+    memset(&sim, 0, sizeof(sim));
+    memset(timers[0].out, 0, sizeof(timers[0].out));
+    memset(timers[1].out, 0, sizeof(timers[1].out));
+    timers[0].prescaler = timers[1].prescaler = 0;
+    timers[0].down = timers[1].down = 0;
+
+    // Valores de reset
+    *(uint16_t*)&SIM_memory[0x0120] = 0x9640;       // PMMCTL0, bloqueado
+    *(uint16_t*)&SIM_memory[0x0130] = LOCKLPM5;     // PM5CTL0
+    *(uint16_t*)&SIM_memory[0x0160] = PFWP | DFWP;  // SYSCFG0
+    *(uint16_t*)&SIM_memory[WDT_A_BASE] = 0x6904;   // WDTCTL
+    *(uint16_t*)&SIM_memory[CRC_BASE + OFS_CRCINIRES] = 0xFFFF;
+    *(uint16_t*)&SIM_memory[CRC_BASE + OFS_CRCRESR] = 0xFFFF;
+    *(uint16_t*)&SIM_memory[EUSCI_A0_BASE + OFS_UCAxCTLW0] = UCSWRST;
+    *(uint16_t*)&SIM_memory[EUSCI_A0_BASE + OFS_UCAxIFG] = UCTXIFG;
+    *(uint16_t*)&SIM_memory[EUSCI_B0_BASE + OFS_UCBxCTLW0] = UCSWRST;
+    *(uint16_t*)&SIM_memory[EUSCI_B0_BASE + OFS_UCBxIFG] = UCTXIFG;
+    *(uint16_t*)&SIM_memory[CS_BASE + OFS_CSCTL1] = 0x0033;     // DCORSEL_1
+    *(uint16_t*)&SIM_memory[CS_BASE + OFS_CSCTL2] = 0x101F;     // FLLD__2, N = 31
+    *(uint16_t*)&SIM_memory[CS_BASE + OFS_CSCTL3] = SELREF__REFOCLK;
+    *(uint16_t*)&SIM_memory[CS_BASE + OFS_CSCTL4] = SELA__REFOCLK + SELMS__DCOCLKDIV;
+    *(uint16_t*)&SIM_memory[CS_BASE + OFS_CSCTL6] = 0x00C1;     // XT1DRIVE_3, XT1AUTOOFF
+    memcpy(shadow, SIM_memory, SIM_MEMORY_SIZE);
+
+    sim.supplyMv = SIM_VCC_MV;
+    sim.limit = (uint64_t)SIM_TIME_LIMIT_MS * SIM_MCLK_HZ / 1000;
+}
+//*****************************************************************************
+void SIM_setInput(const uint8_t channel, const uint16_t millivolts)
+{
+    if(channel < 16)
+        sim.inputMv[channel] = millivolts;
+}
+//*****************************************************************************
+void SIM_setSupply(const uint16_t millivolts)
+{
+    sim.supplyMv = millivolts;
+}
+//*****************************************************************************
+void SIM_setPin(const uint8_t port, const uint8_t pin, const uint8_t level)
+{
+    if(port < 1 || port > SIM_PORTS || pin > 7)
+        return;
+
+    if(level)
+        sim.pinLevel[port - 1] |= 0x01 << pin;
+    else
+        sim.pinLevel[port - 1] &= ~(0x01 << pin);
+    SIM_gpioUpdate();
+}
+//*****************************************************************************
+void SIM_setTimeLimit(const uint32_t ms)
+{
+    sim.limit = (uint64_t)ms * SIM_MCLK_HZ / 1000;
+}
+//*****************************************************************************
+void SIM_getCounters(SIM_counters* counters)
+{
+    SIM_commit();                           // Incluye el acceso pendiente
+    *counters = sim.counters;
+}
+//*****************************************************************************
+void SIM_onUartTx(const SIM_txHook hook)
+{
+    sim.uartHook = hook;
+}
+//*****************************************************************************
+void SIM_onSpiTx(const SIM_txHook hook)
+{
+    sim.spiHook = hook;
+}
+//*****************************************************************************
+void SIM_finish(const char* reason, const int status)
+{
+    uint16_t base;
+    uint8_t port;
+
+    printf("---\n");
+    printf("end:         %s\n", reason);
+    printf("time:        %lu us\n", (unsigned long)SIM_micros());
+    printf("active:      %llu cycles\n", (unsigned long long)sim.counters.activeCycles);
+    printf("lpm:         %llu cycles\n", (unsigned long long)sim.counters.lpmCycles);
+    printf("reads:       %lu\n", (unsigned long)sim.counters.reads);
+    printf("writes:      %lu\n", (unsigned long)sim.counters.writes);
+    printf("conversions: %lu\n", (unsigned long)sim.adcConversions);
+    printf("uart:        %lu bytes, %lu frames\n", (unsigned long)sim.uartBytes, (unsigned long)sim.uartFrames);
+    printf("spi:         %lu bytes\n", (unsigned long)sim.spiBytes);
+    printf("LOCKLPM5:    %u\n", SIM_peek16(0x0130) & LOCKLPM5);
+    for(port = 1; port <= SIM_PORTS; port++)
+    {
+        base = SIM_PORT_BASE(port);
+        printf("P%u:          OUT=0x%02X DIR=0x%02X REN=0x%02X\n", port,
+               SIM_memory[base + OFS_PAOUT], SIM_memory[base + OFS_PADIR], SIM_memory[base + OFS_PAREN]);
+    }
+
+    fflush(stdout);
+    exit(status);
+}
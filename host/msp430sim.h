@@ -0,0 +1,259 @@
+/**
+  * @file     msp430sim.h
+  * @brief    Modelo de los perifricos del MSP430FR4133 para la compilacin en
+  *           la PC.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// msp430sim.h - Modelo de ADC, Timer_A0/A1, referencia del PMM, puertos y MPY32.
+//
+//*****************************************************************************
+
+#ifndef MSP430SIM_H_
+#define MSP430SIM_H_
+
+//*****************************************************************************
+//                              Include
+//*****************************************************************************
+#include <stdint.h>
+
+//*****************************************************************************
+//                              Definiciones
+//*****************************************************************************
+//*****************************************************************************
+//! @name Parmetros del modelo:
+//! \brief El tiempo avanza en ciclos de MCLK. SMCLK = MCLK = DCOCLKDIV, el
+//!        valor de reset del FLL con REFO (32 x 32768 Hz).
+//! @{
+//*****************************************************************************
+#define SIM_MCLK_HZ             1048576UL   // MCLK y SMCLK
+#define SIM_ACLK_HZ             32768UL     // ACLK = REFO
+#define SIM_MODOSC_HZ           4800000UL   // Reloj del ADC (MODOSC)
+#define SIM_READ_CYCLES         3           // MOV &reg,Rn
+#define SIM_WRITE_CYCLES        4           // MOV Rn,&reg / BIS #n,&reg
+#define SIM_CALL_CYCLES         9           // CALLA (5) y RETA (4)
+#define SIM_ISR_CYCLES          11          // Entrada (6) y RETI (5)
+#define SIM_MUL_CYCLES          12          // __mulsi3: signo y resultado
+#define SIM_MUL_BIT_CYCLES      16          // __mulsi3: una vuelta del lazo
+#define SIM_REF_SETTLE_CYCLES   30          // Hasta REFGENRDY
+#define SIM_VREF_MV             1500        // Referencia interna (A13)
+#define SIM_VCC_MV              3300        // AVCC por defecto
+#define SIM_TIME_LIMIT_MS       60000UL     // Corta la simulacin
+#define SIM_NESTING             4           // Interrupciones anidadas
+#define SIM_PORTS               8
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! @name Cdigos de salida de la simulacin:
+//! @{
+//*****************************************************************************
+#define SIM_EXIT_IDLE           0           // LPM sin fuentes de despertar
+#define SIM_EXIT_FAULT          1           // Acceso que provocara un PUC
+#define SIM_EXIT_TIMEOUT        2           // Se alcanz el lmite de tiempo
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//                              Tipos
+//*****************************************************************************
+//*****************************************************************************
+//
+//! \brief Contadores acumulados desde el reset.
+//
+//*****************************************************************************
+typedef struct SIM_counters
+{
+    uint32_t reads;                         // Lecturas de registros
+    uint32_t writes;                        // Escrituras de registros
+    uint64_t activeCycles;                  // Ciclos de MCLK con la CPU activa
+    uint64_t lpmCycles;                     // Ciclos de MCLK en LPM
+} SIM_counters;
+
+//*****************************************************************************
+//
+//! \brief Recibe cada byte que termina de salir por la lnea de un eUSCI.
+//
+//*****************************************************************************
+typedef void (*SIM_txHook)(const uint8_t data);
+
+//*****************************************************************************
+//                              Variables
+//*****************************************************************************
+extern uint8_t* SIM_memory;                 // 64 KB, vista del modelo
+
+//*****************************************************************************
+//                              Prototipos
+//*****************************************************************************
+//*****************************************************************************
+//
+//! \brief Reinicia el dispositivo simulado (POR) con los valores de reset de
+//!        los registros, AVCC en \b SIM_VCC_MV y todas las entradas en 0 mV.
+//!
+//! \return None
+//
+//*****************************************************************************
+extern void SIM_reset(void);
+
+//*****************************************************************************
+//
+//! \brief Tensin aplicada a una entrada analgica.
+//!
+//! \param channel: Canal del ADC (A0-A9).
+//! \param millivolts: Tensin en la entrada.
+//!
+//! \return None
+//
+//*****************************************************************************
+extern void SIM_setInput(const uint8_t channel, const uint16_t millivolts);
+
+//*****************************************************************************
+//
+//! \brief Tensin de alimentacin AVCC, referencia de las conversiones con
+//!        ADCSREF_0.
+//!
+//! \param millivolts: Tensin de alimentacin.
+//!
+//! \return None
+//
+//*****************************************************************************
+extern void SIM_setSupply(const uint16_t millivolts);
+
+//*****************************************************************************
+//
+//! \brief Nivel externo de un pin configurado como entrada.
+//!
+//! \param port: Puerto (1-8).
+//! \param pin: Pin del puerto (0-7).
+//! \param level: 0 o 1.
+//!
+//! \return None
+//
+//*****************************************************************************
+extern void SIM_setPin(const uint8_t port, const uint8_t pin, const uint8_t level);
+
+//*****************************************************************************
+//
+//! \brief Lmite de tiempo simulado.
+//!
+//! \param ms: Milisegundos antes de cortar la simulacin.
+//!
+//! \return None
+//
+//*****************************************************************************
+extern void SIM_setTimeLimit(const uint32_t ms);
+
+//*****************************************************************************
+//
+//! \brief Contadores de accesos y de tiempo activo y en LPM. El acceso
+//!        pendiente se entrega antes al modelo, as queda a cuenta de quien
+//!        lo hizo. Una lectura-modificacin-escritura cuenta como escritura.
+//!
+//! \param counters: Destino de los contadores.
+//!
+//! \return None
+//
+//*****************************************************************************
+extern void SIM_getCounters(SIM_counters* counters);
+
+//*****************************************************************************
+//
+//! \brief Captura lo que transmite el eUSCI_A0 (UCA0TXD), byte a byte y en
+//!        el momento en que termina el bit de parada. SIM_reset() la quita.
+//!
+//! \param hook: Funcin a llamar, o NULL para dejar de capturar.
+//!
+//! \return None
+//
+//*****************************************************************************
+extern void SIM_onUartTx(const SIM_txHook hook);
+
+//*****************************************************************************
+//
+//! \brief Captura lo que transmite el eUSCI_B0 (UCB0SIMO), byte a byte y en
+//!        el momento en que termina el ltimo flanco. SIM_reset() la quita.
+//!
+//! \param hook: Funcin a llamar, o NULL para dejar de capturar.
+//!
+//! \return None
+//
+//*****************************************************************************
+extern void SIM_onSpiTx(const SIM_txHook hook);
+
+//*****************************************************************************
+//
+//! \brief Imprime el resumen de la simulacin y termina el proceso.
+//!
+//! \param reason: Motivo de la finalizacin.
+//! \param status: Cdigo de salida, \b SIM_EXIT_IDLE, \b SIM_EXIT_FAULT o
+//!        \b SIM_EXIT_TIMEOUT.
+//!
+//! \return None
+//
+//*****************************************************************************
+extern void SIM_finish(const char* reason, const int status);
+
+//*****************************************************************************
+//
+//! \brief Acceso a un registro. El acceso anterior se entrega al modelo como
+//!        escritura si escribir por el puntero provoc la trampa de la vista
+//!        de solo lectura, o como lectura si no.
+//!
+//! \param address: Direccin del registro.
+//!
+//! \return Puntero a la posicin en la vista de solo lectura del firmware.
+//
+//*****************************************************************************
+extern volatile uint8_t* SIM_reg8(const uint16_t address);
+extern volatile uint16_t* SIM_reg16(const uint16_t address);
+extern volatile uint32_t* SIM_reg32(const uint16_t address);
+
+//*****************************************************************************
+//
+//! \brief Intrnsecos sobre el registro de estado. Entrar en LPM hace avanzar
+//!        el modelo hasta que una interrupcin limpia CPUOFF.
+//!
+//! \param bits: Bits del SR.
+//!
+//! \return None
+//
+//*****************************************************************************
+extern void SIM_bisSR(const uint16_t bits);
+extern void SIM_bicSR(const uint16_t bits);
+extern void SIM_bisSROnExit(const uint16_t bits);
+extern void SIM_bicSROnExit(const uint16_t bits);
+extern uint16_t SIM_getSR(void);
+
+//*****************************************************************************
+//
+//! \brief Espera activa de \b cycles ciclos de MCLK.
+//!
+//! \param cycles: Ciclos de MCLK.
+//!
+//! \return None
+//
+//*****************************************************************************
+extern void SIM_delayCycles(const uint32_t cycles);
+
+//*****************************************************************************
+//
+//! \brief Producto de 32 bits con el costo de la rutina de la librera de GCC
+//!        para el MSP430 sin multiplicador: sumas y desplazamientos por cada
+//!        bit de \b b hasta que se agota, ms la llamada y el signo.
+//!
+//! \param a: Multiplicando.
+//! \param b: Multiplicador.
+//!
+//! \return a * b
+//
+//*****************************************************************************
+extern int32_t SIM_multiply(const int32_t a, const int32_t b);
+
+#endif /* MSP430SIM_H_ */
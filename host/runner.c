@@ -0,0 +1,56 @@
+/**
+  * @file     runner.c
+  * @brief    Ejecuta main.c sobre el MSP430FR4133 simulado.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// runner.c - Uso: adcsim [A<n>=<mV>] [VCC=<mV>] [P<port>.<pin>=<0|1>] [T=<ms>]
+//                        [CYCLE=<funcin>]
+//
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "msp430.h"
+#include "simprofile.h"
+
+// main() del firmware, renombrado al compilar main.c
+extern int SIM_firmwareMain(void);
+
+int main(int argc, char** argv)
+{
+    unsigned channel, port, pin, value;
+    const char* root = NULL;
+    int i;
+
+    SIM_reset();
+
+    for(i = 1; i < argc; i++)
+    {
+        if(sscanf(argv[i], "A%u=%u", &channel, &value) == 2 && channel < 16)
+            SIM_setInput(channel, value);
+        else if(sscanf(argv[i], "VCC=%u", &value) == 1)
+            SIM_setSupply(value);
+        else if(sscanf(argv[i], "P%u.%u=%u", &port, &pin, &value) == 3)
+            SIM_setPin(port, pin, value);
+        else if(sscanf(argv[i], "T=%u", &value) == 1)
+            SIM_setTimeLimit(value);
+        else if(strncmp(argv[i], "CYCLE=", 6) == 0)
+            root = argv[i] + 6;
+        else
+        {
+            fprintf(stderr, "usage: %s [A<n>=<mV>] [VCC=<mV>] [P<port>.<pin>=<0|1>] [T=<ms>] [CYCLE=<function>]\n", argv[0]);
+            return(EXIT_FAILURE);
+        }
+    }
+
+    SIM_profileInit(argv[0], root);
+    SIM_firmwareMain();
+    SIM_finish("main returned", SIM_EXIT_IDLE);
+
+    return(SIM_EXIT_IDLE);
+}
@@ -0,0 +1,235 @@
+/**
+  * @file     simprofile.c
+  * @brief    Costo por funcin del firmware sobre el MSP430FR4133 simulado.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// simprofile.c - El firmware se compila con -finstrument-functions. Cada
+// entrada toma una foto de los contadores del modelo y cada salida suma la
+// diferencia a la funcin: los valores son inclusivos (llamadas internas e
+// interrupciones atendidas durante la funcin incluidas). El retorno de la
+// funcin raz cierra el ciclo de medicin e imprime el informe.
+//
+// Una escritura cuenta como tal aunque repita el valor del registro: el
+// modelo la reconoce por la trampa de la vista de solo lectura.
+//
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "msp430sim.h"
+#include "simprofile.h"
+
+#define SIM_NO_INSTRUMENT       __attribute__((no_instrument_function))
+
+//*****************************************************************************
+//                              Tipos
+//*****************************************************************************
+typedef struct SIM_symbol
+{
+    uintptr_t address;
+    char name[48];
+} SIM_symbol;
+
+typedef struct SIM_function
+{
+    const void* address;
+    const char* name;
+    uint32_t calls;
+    SIM_counters total;
+} SIM_function;
+
+typedef struct SIM_frame
+{
+    SIM_function* function;
+    SIM_counters start;
+} SIM_frame;
+
+//*****************************************************************************
+//                              Variables
+//*****************************************************************************
+static SIM_symbol symbols[SIM_PROFILE_SYMBOLS];
+static uint16_t symbolCount;
+static const char* rootName = SIM_PROFILE_ROOT;
+
+static SIM_function functions[SIM_PROFILE_FUNCTIONS];
+static uint8_t functionCount;
+static SIM_frame frames[SIM_PROFILE_DEPTH];
+static uint8_t depth;
+static uint8_t rootDepth;                   // 0: fuera de un ciclo
+static uint16_t cycle;
+
+//*****************************************************************************
+//                              Prototipos
+//*****************************************************************************
+void __cyg_profile_func_enter(void* fn, void* caller) SIM_NO_INSTRUMENT;
+void __cyg_profile_func_exit(void* fn, void* caller) SIM_NO_INSTRUMENT;
+
+//*****************************************************************************
+static int SIM_compareSymbols(const void* a, const void* b)
+{
+    uintptr_t x = ((const SIM_symbol*)a)->address;
+    uintptr_t y = ((const SIM_symbol*)b)->address;
+
+    return((x > y) - (x < y));
+}
+//*****************************************************************************
+void SIM_profileInit(const char* executable, const char* root)
+{
+    char command[256];
+    char line[128];
+    unsigned long long value;
+    char type;
+    char name[sizeof(symbols[0].name)];
+    uintptr_t bias = 0;
+    uint16_t i;
+    FILE* nm;
+
+    if(root)
+        rootName = root;
+
+    // Sin nm los informes muestran direcciones
+    snprintf(command, sizeof(command), "nm --defined-only '%s' 2>/dev/null", executable);
+    nm = popen(command, "r");
+    if(nm == NULL)
+        return;
+
+    while(fgets(line, sizeof(line), nm) && symbolCount < SIM_PROFILE_SYMBOLS)
+    {
+        if(sscanf(line, "%llx %c %47s", &value, &type, name) != 3)
+            continue;
+        if(type != 'T' && type != 't' && type != 'W' && type != 'w')
+            continue;
+        symbols[symbolCount].address = (uintptr_t)value;
+        strcpy(symbols[symbolCount].name, name);
+        symbolCount++;
+    }
+    pclose(nm);
+
+    // Desplazamiento de carga del ejecutable (PIE)
+    for(i = 0; i < symbolCount; i++)
+        if(strcmp(symbols[i].name, "SIM_profileInit") == 0)
+            bias = (uintptr_t)&SIM_profileInit - symbols[i].address;
+    for(i = 0; i < symbolCount; i++)
+        symbols[i].address += bias;
+
+    qsort(symbols, symbolCount, sizeof(symbols[0]), SIM_compareSymbols);
+}
+//*****************************************************************************
+static SIM_NO_INSTRUMENT const char* SIM_symbolName(const void* address)
+{
+    static char unknown[SIM_PROFILE_FUNCTIONS][20];
+    SIM_symbol key;
+    SIM_symbol* symbol;
+
+    key.address = (uintptr_t)address;
+    symbol = bsearch(&key, symbols, symbolCount, sizeof(symbols[0]), SIM_compareSymbols);
+    if(symbol)
+        return(symbol->name);
+
+    snprintf(unknown[functionCount], sizeof(unknown[0]), "%p", address);
+    return(unknown[functionCount]);
+}
+//*****************************************************************************
+static SIM_NO_INSTRUMENT SIM_function* SIM_findFunction(const void* address)
+{
+    uint8_t i;
+
+    for(i = 0; i < functionCount; i++)
+        if(functions[i].address == address)
+            return(&functions[i]);
+
+    if(functionCount == SIM_PROFILE_FUNCTIONS)
+        return(NULL);
+
+    memset(&functions[functionCount], 0, sizeof(functions[0]));
+    functions[functionCount].address = address;
+    functions[functionCount].name = SIM_symbolName(address);
+
+    return(&functions[functionCount++]);
+}
+//*****************************************************************************
+static SIM_NO_INSTRUMENT void SIM_report(void)
+{
+    SIM_function* f;
+    uint8_t i;
+
+    printf("=== cycle %u: %s ===\n", cycle, rootName);
+    printf("%-24s %6s %7s %7s %10s %10s\n", "function", "calls", "reads", "writes", "active", "lpm");
+    for(i = 0; i < functionCount; i++)
+    {
+        f = &functions[i];
+        printf("%-24s %6lu %7lu %7lu %10llu %10llu\n", f->name, (unsigned long)f->calls,
+               (unsigned long)f->total.reads, (unsigned long)f->total.writes,
+               (unsigned long long)f->total.activeCycles, (unsigned long long)f->total.lpmCycles);
+    }
+}
+//*****************************************************************************
+void __cyg_profile_func_enter(void* fn, void* caller)
+{
+    SIM_frame* frame;
+    SIM_function* function = SIM_findFunction(fn);
+    uint8_t i;
+
+    (void)caller;
+
+    if(depth >= SIM_PROFILE_DEPTH)
+    {
+        depth++;                            // No se registra, pero s su salida
+        return;
+    }
+
+    // Un ciclo nuevo comienza con la tabla vaca; las funciones que lo
+    // contienen quedan fuera del informe
+    if(!rootDepth && function && strcmp(function->name, rootName) == 0)
+    {
+        for(i = 0; i < depth; i++)
+            frames[i].function = NULL;
+        functionCount = 0;
+        function = SIM_findFunction(fn);
+        rootDepth = depth + 1;
+        cycle++;
+    }
+
+    frame = &frames[depth++];
+    frame->function = function;
+    SIM_getCounters(&frame->start);
+
+    // CALLA y RETA se cargan a la funcin llamada
+    SIM_delayCycles(SIM_CALL_CYCLES);
+}
+//*****************************************************************************
+void __cyg_profile_func_exit(void* fn, void* caller)
+{
+    SIM_frame* frame;
+    SIM_counters now;
+    SIM_function* f;
+
+    (void)fn;
+    (void)caller;
+
+    if(depth == 0 || --depth >= SIM_PROFILE_DEPTH)
+        return;
+
+    frame = &frames[depth];
+    f = frame->function;
+    if(f)
+    {
+        SIM_getCounters(&now);
+        f->calls++;
+        f->total.reads += now.reads - frame->start.reads;
+        f->total.writes += now.writes - frame->start.writes;
+        f->total.activeCycles += now.activeCycles - frame->start.activeCycles;
+        f->total.lpmCycles += now.lpmCycles - frame->start.lpmCycles;
+    }
+
+    if(rootDepth == depth + 1)
+    {
+        SIM_report();
+        rootDepth = 0;
+    }
+}
@@ -0,0 +1,47 @@
+/**
+  * @file     simprofile.h
+  * @brief    Costo por funcin del firmware sobre el MSP430FR4133 simulado.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// simprofile.h - Accesos a registros, ciclos activos y tiempo en LPM por
+//                funcin, con un informe por ciclo de medicin.
+//
+//*****************************************************************************
+
+#ifndef SIMPROFILE_H_
+#define SIMPROFILE_H_
+
+//*****************************************************************************
+//                              Include
+//*****************************************************************************
+#include <stdint.h>
+
+//*****************************************************************************
+//                              Definiciones
+//*****************************************************************************
+#define SIM_PROFILE_FUNCTIONS   64          // Funciones distintas por ciclo
+#define SIM_PROFILE_DEPTH       32          // Profundidad de llamadas
+#define SIM_PROFILE_SYMBOLS     4096        // Smbolos ledos con nm
+#define SIM_PROFILE_ROOT        "SENSOR_measureAll"
+
+//*****************************************************************************
+//                              Prototipos
+//*****************************************************************************
+//*****************************************************************************
+//
+//! \brief Carga los nombres de las funciones del ejecutable (nm) y fija la
+//!        funcin que delimita un ciclo de medicin.
+//!
+//! \param executable: Ruta del ejecutable, normalmente argv[0].
+//! \param root: Funcin cuyo retorno cierra un ciclo y emite el informe.
+//!
+//! \return None
+//
+//*****************************************************************************
+extern void SIM_profileInit(const char* executable, const char* root);
+
+#endif /* SIMPROFILE_H_ */
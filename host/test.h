@@ -0,0 +1,58 @@
+/**
+  * @file     test.h
+  * @brief    Verificaciones de las pruebas en la PC.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// test.h - Cada prueba es un ejecutable que enlaza el firmware con el modelo
+//          del MSP430FR4133 y termina con TEST_end(). make test las ejecuta.
+//
+//*****************************************************************************
+
+#ifndef TEST_H_
+#define TEST_H_
+
+//*****************************************************************************
+//                              Include
+//*****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+
+//*****************************************************************************
+//                              Definiciones
+//*****************************************************************************
+static unsigned testChecks;
+static unsigned testFailures;
+
+//*****************************************************************************
+//
+//! \brief Verifica una condicin; si falla informa el archivo, la lnea y la
+//!        condicin, y la prueba contina.
+//
+//*****************************************************************************
+#define TEST_CHECK(condition)                                               \
+    do                                                                      \
+    {                                                                       \
+        testChecks++;                                                       \
+        if(!(condition))                                                    \
+        {                                                                   \
+            testFailures++;                                                 \
+            printf("%s:%d: FAIL %s\n", __FILE__, __LINE__, #condition);     \
+        }                                                                   \
+    } while(0)
+
+//*****************************************************************************
+//
+//! \brief Resumen de la prueba.
+//!
+//! \return Cdigo de salida: 0 si no hubo fallas.
+//
+//*****************************************************************************
+#define TEST_end()                                                          \
+    (printf("%s: %u checks, %u failures\n", __FILE__, testChecks, testFailures), \
+     testFailures ? EXIT_FAILURE : EXIT_SUCCESS)
+
+#endif /* TEST_H_ */
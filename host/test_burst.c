@@ -0,0 +1,148 @@
+/**
+  * @file     test_burst.c
+  * @brief    Prueba del envo de bloques por SPI.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// test_burst.c - Captura lo que sale por UCB0SIMO con SIM_onSpiTx() y
+//                verifica el orden de los bytes, que la interrupcin inicie
+//                el bloque que qued esperando, el conteo de muestras
+//                descartadas y el envo de un bloque incompleto con
+//                BURST_flush().
+//
+//*****************************************************************************
+
+#include "msp430.h"
+#include "test.h"
+#include "burst.h"
+
+#define TEST_LINE_SIZE (8 * BURST_SAMPLES)
+
+static uint8_t line[TEST_LINE_SIZE];
+static uint16_t lineLength;
+
+//*****************************************************************************
+static void TEST_capture(const uint8_t data)
+{
+    if(lineLength < TEST_LINE_SIZE)
+        line[lineLength++] = data;
+}
+//*****************************************************************************
+// Espera a que salga el ltimo byte
+static void TEST_drain(void)
+{
+    while(BURST_isSending())
+        __delay_cycles(50);
+}
+//*****************************************************************************
+// Valor de la muestra n de cada prueba, con los dos bytes distintos
+static uint16_t TEST_sample(const uint16_t n)
+{
+    return(0xA500 + n * 0x0102 + 1);
+}
+//*****************************************************************************
+// La lnea tiene las muestras 0..count-1, byte bajo primero
+static uint8_t TEST_line(const uint16_t count)
+{
+    uint16_t i;
+
+    if(lineLength != 2 * count)
+        return(0);
+    for(i = 0; i < count; i++)
+        if(line[2 * i] != (uint8_t)TEST_sample(i) || line[2 * i + 1] != (uint8_t)(TEST_sample(i) >> 8))
+            return(0);
+
+    return(1);
+}
+//*****************************************************************************
+// Un bloque completo sale solo, byte bajo primero
+static void TEST_order(void)
+{
+    uint16_t i;
+
+    lineLength = 0;
+    for(i = 0; i < BURST_SAMPLES; i++)
+        TEST_CHECK(BURST_put(TEST_sample(i)) == STATUS_SUCCESS);
+    TEST_drain();
+
+    TEST_CHECK(TEST_line(BURST_SAMPLES));
+    TEST_CHECK(BURST_takeOverruns() == 0);
+}
+//*****************************************************************************
+// Sin GIE se llenan los dos bloques: el primero queda en envo, el segundo
+// esperando y el siguiente se descarta. Al habilitar las interrupciones la
+// ISR enva el primero e inicia el segundo
+static void TEST_sequence(void)
+{
+    uint16_t i;
+
+    lineLength = 0;
+    __disable_interrupt();
+    for(i = 0; i < 2 * BURST_SAMPLES; i++)
+        TEST_CHECK(BURST_put(TEST_sample(i)) == STATUS_SUCCESS);
+    TEST_CHECK(BURST_put(0xFFFF) == STATUS_FAIL);
+    TEST_CHECK(BURST_put(0xFFFF) == STATUS_FAIL);
+    TEST_CHECK(BURST_isSending());
+    TEST_CHECK(BURST_flush() == STATUS_FAIL);
+    TEST_CHECK(BURST_setClock(BURST_CLOCK_HZ / 2) == STATUS_FAIL);
+    TEST_CHECK(lineLength == 0);
+    __enable_interrupt();
+    TEST_drain();
+
+    TEST_CHECK(TEST_line(2 * BURST_SAMPLES));
+    TEST_CHECK(BURST_takeOverruns() == 2);
+    TEST_CHECK(BURST_takeOverruns() == 0);
+}
+//*****************************************************************************
+// Bloques incompletos: BURST_flush() no inicia uno mientras otro est en
+// envo ni uno vaco
+static void TEST_flush(void)
+{
+    uint16_t i;
+
+    lineLength = 0;
+    TEST_CHECK(BURST_flush() == STATUS_FAIL);
+
+    __disable_interrupt();
+    for(i = 0; i < 3; i++)
+        BURST_put(TEST_sample(i));
+    TEST_CHECK(BURST_flush() == STATUS_SUCCESS);
+    for(; i < 5; i++)
+        BURST_put(TEST_sample(i));
+    TEST_CHECK(BURST_flush() == STATUS_FAIL);
+    __enable_interrupt();
+    TEST_drain();
+    TEST_CHECK(lineLength == 2 * 3);
+
+    TEST_CHECK(BURST_flush() == STATUS_SUCCESS);
+    TEST_drain();
+    TEST_CHECK(TEST_line(5));
+    TEST_CHECK(BURST_flush() == STATUS_FAIL);
+
+    // Un bloque que se completa despus sigue desde el comienzo
+    lineLength = 0;
+    TEST_CHECK(BURST_setClock(BURST_CLOCK_HZ / 2) == STATUS_SUCCESS);
+    for(i = 0; i < BURST_SAMPLES; i++)
+        BURST_put(TEST_sample(i));
+    TEST_drain();
+    TEST_CHECK(TEST_line(BURST_SAMPLES));
+}
+//*****************************************************************************
+int main(void)
+{
+    SIM_reset();
+    SIM_onSpiTx(TEST_capture);
+    PM5CTL0 &= ~LOCKLPM5;
+
+    TEST_CHECK(BURST_init(BURST_CLOCK_HZ) == STATUS_SUCCESS);
+    __enable_interrupt();
+
+    TEST_order();
+    TEST_sequence();
+    TEST_flush();
+
+    return(TEST_end());
+}
@@ -0,0 +1,232 @@
+/**
+  * @file     test_codec.c
+  * @brief    Prueba de ida y vuelta del codec y tasa de compresin.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// test_codec.c - Codifica secuencias en bloques de CODEC_BLOCK_SIZE bytes
+//                como lo hara el programa (CODEC_put() hasta que falla,
+//                CODEC_finish() y otro bloque), decodifica cada bloque y lo
+//                compara con la entrada. Imprime la tasa contra muestras de
+//                16 bits.
+//
+//*****************************************************************************
+
+#include <string.h>
+#include "msp430.h"
+#include "test.h"
+#include "codec.h"
+
+#define TEST_SAMPLES    4096
+#define TEST_FULL_SCALE 1023                // ADC de 10 bits
+
+static uint16_t input[TEST_SAMPLES];
+static uint32_t seed;
+
+//*****************************************************************************
+static uint16_t TEST_random(void)
+{
+    // xorshift32, repetible entre corridas
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    return((uint16_t)seed);
+}
+//*****************************************************************************
+// Ruido de range cuentas, ms probable cerca de 0
+static int16_t TEST_noise(const uint8_t range)
+{
+    return((int16_t)(TEST_random() % (range + 1)) - (int16_t)(TEST_random() % (range + 1)));
+}
+//*****************************************************************************
+static uint16_t TEST_clamp(const int32_t value)
+{
+    if(value < 0)
+        return(0);
+    if(value > TEST_FULL_SCALE)
+        return(TEST_FULL_SCALE);
+
+    return((uint16_t)value);
+}
+//*****************************************************************************
+// Cierra el bloque, lo decodifica y lo compara con la entrada
+static uint16_t TEST_block(CODEC_encoder* encoder, const uint16_t* expected)
+{
+    uint16_t decoded[CODEC_BLOCK_SAMPLES];
+    uint16_t length = CODEC_finish(encoder);
+    uint16_t count = CODEC_decode(encoder->data, length, decoded, CODEC_BLOCK_SAMPLES);
+
+    TEST_CHECK(length <= CODEC_BLOCK_SIZE);
+    TEST_CHECK(count == encoder->count);
+    TEST_CHECK(memcmp(decoded, expected, count * sizeof(uint16_t)) == 0);
+
+    return(length);
+}
+//*****************************************************************************
+// Devuelve la tasa de compresin contra 2 bytes por muestra
+static double TEST_roundTrip(const char* name, const uint16_t* samples, const uint16_t n)
+{
+    uint8_t block[CODEC_BLOCK_SIZE];
+    CODEC_encoder encoder;
+    uint32_t bytes = 0;
+    uint16_t blocks = 0;
+    uint16_t first = 0;
+    uint16_t i;
+
+    CODEC_initEncoder(&encoder, block, sizeof(block));
+    for(i = 0; i < n; i++)
+    {
+        if(CODEC_put(&encoder, samples[i]) == STATUS_FAIL)
+        {
+            bytes += TEST_block(&encoder, &samples[first]);
+            blocks++;
+            first = i;
+            CODEC_initEncoder(&encoder, block, sizeof(block));
+            TEST_CHECK(CODEC_put(&encoder, samples[i]) == STATUS_SUCCESS);
+        }
+    }
+    bytes += TEST_block(&encoder, &samples[first]);
+    blocks++;
+
+    printf("%-10s %5u samples, %4u blocks, %5lu bytes, ratio %5.2f\n", name, n, blocks,
+           (unsigned long)bytes, 2.0 * n / bytes);
+
+    return(2.0 * n / bytes);
+}
+//*****************************************************************************
+// Bordes de un bloque: 64 muestras iguales, la racha final implcita, 1
+// cuenta en 3 bits, un bloque lleno, una racha pendiente y saltos de 16 bits
+static void TEST_boundaries(void)
+{
+    uint8_t block[CODEC_BLOCK_SIZE];
+    uint16_t samples[CODEC_BLOCK_SAMPLES];
+    uint16_t decoded[CODEC_BLOCK_SAMPLES + 1];
+    CODEC_encoder encoder;
+    uint16_t length;
+    uint8_t i;
+
+    // 1 + 63 iguales: cabecera y primera muestra, 22 bits
+    CODEC_initEncoder(&encoder, block, sizeof(block));
+    for(i = 0; i < CODEC_BLOCK_SAMPLES; i++)
+        TEST_CHECK(CODEC_put(&encoder, 0x0155) == STATUS_SUCCESS);
+    TEST_CHECK(CODEC_put(&encoder, 0x0155) == STATUS_FAIL);
+    length = CODEC_finish(&encoder);
+    TEST_CHECK(length == 3);
+    TEST_CHECK(CODEC_decode(block, length, decoded, sizeof(decoded) / sizeof(decoded[0])) == CODEC_BLOCK_SAMPLES);
+    for(i = 0; i < CODEC_BLOCK_SAMPLES; i++)
+        TEST_CHECK(decoded[i] == 0x0155);
+
+    // Una rampa y una racha hasta el final ocupan lo mismo que la rampa sola
+    CODEC_initEncoder(&encoder, block, sizeof(block));
+    for(i = 0; i < 10; i++)
+        CODEC_put(&encoder, 300 + i);
+    length = CODEC_finish(&encoder);
+    CODEC_initEncoder(&encoder, block, sizeof(block));
+    for(i = 0; i < CODEC_BLOCK_SAMPLES; i++)
+    {
+        samples[i] = 300 + (i < 10 ? i : 9);
+        TEST_CHECK(CODEC_put(&encoder, samples[i]) == STATUS_SUCCESS);
+    }
+    TEST_CHECK(TEST_block(&encoder, samples) == length);
+
+    // 1 cuenta: 3 bits o menos por muestra
+    CODEC_initEncoder(&encoder, block, sizeof(block));
+    for(i = 0; i < CODEC_BLOCK_SAMPLES; i++)
+    {
+        samples[i] = 500 + (i & 1);
+        TEST_CHECK(CODEC_put(&encoder, samples[i]) == STATUS_SUCCESS);
+    }
+    TEST_CHECK(TEST_block(&encoder, samples) <= (CODEC_COUNT_BITS + 16 + 3 * (CODEC_BLOCK_SAMPLES - 1) + 7) / 8);
+
+    // Saltos de fondo de escala hasta llenar el bloque: lo que falta no
+    // alcanza para un escape
+    CODEC_initEncoder(&encoder, block, sizeof(block));
+    for(i = 0; CODEC_put(&encoder, (i & 1) ? 0 : TEST_FULL_SCALE) == STATUS_SUCCESS; i++)
+        samples[i] = (i & 1) ? 0 : TEST_FULL_SCALE;
+    TEST_CHECK(encoder.bits + CODEC_ESCAPE + 16 > CODEC_BLOCK_SIZE * 8);
+    TEST_CHECK(TEST_block(&encoder, samples) <= CODEC_BLOCK_SIZE);
+
+    // Una racha pendiente que debe cerrarse cuenta al decidir si entra: el
+    // escape solo ocupa 22 + 28 bits, con la racha de 5 (3 + 5 bits) no
+    // entra en 7 bytes y s en 8
+    for(length = 7; length <= 8; length++)
+    {
+        CODEC_initEncoder(&encoder, block, length);
+        for(i = 0; i < 6; i++)
+        {
+            samples[i] = 0;
+            TEST_CHECK(CODEC_put(&encoder, samples[i]) == STATUS_SUCCESS);
+        }
+        samples[i] = 0x8000;
+        TEST_CHECK(CODEC_put(&encoder, samples[i]) == (length == 8 ? STATUS_SUCCESS : STATUS_FAIL));
+        TEST_CHECK(TEST_block(&encoder, samples) <= length);
+    }
+
+    // Saltos de 16 bits: escape y luego k grande
+    CODEC_initEncoder(&encoder, block, sizeof(block));
+    samples[0] = 0x0000;
+    samples[1] = 0x8000;
+    samples[2] = 0xFFFF;
+    samples[3] = 0x7FFF;
+    for(i = 0; i < 4; i++)
+        TEST_CHECK(CODEC_put(&encoder, samples[i]) == STATUS_SUCCESS);
+    TEST_CHECK(TEST_block(&encoder, samples) == (CODEC_COUNT_BITS + 16 + CODEC_ESCAPE + 16 + 2 * (1 + 1 + CODEC_K_MAX) + 7) / 8);
+}
+//*****************************************************************************
+int main(void)
+{
+    double random, constant, ramp, step, ec5, battery;
+    int32_t level;
+    uint16_t i;
+
+    SIM_reset();
+
+    TEST_boundaries();
+
+    seed = 0x2545F491;
+    for(i = 0; i < TEST_SAMPLES; i++)
+        input[i] = TEST_random() % (TEST_FULL_SCALE + 1);
+    random = TEST_roundTrip("random", input, TEST_SAMPLES);
+
+    for(i = 0; i < TEST_SAMPLES; i++)
+        input[i] = 612;
+    constant = TEST_roundTrip("constant", input, TEST_SAMPLES);
+
+    for(i = 0; i < TEST_SAMPLES; i++)
+        input[i] = i % (TEST_FULL_SCALE + 1);
+    ramp = TEST_roundTrip("ramp", input, TEST_SAMPLES);
+
+    // Escaln de fondo de escala cada 100 muestras
+    for(i = 0; i < TEST_SAMPLES; i++)
+        input[i] = ((i / 100) & 1) ? TEST_FULL_SCALE : 0;
+    step = TEST_roundTrip("step", input, TEST_SAMPLES);
+
+    // EC5: humedad que deriva lentamente con 1 cuenta de ruido
+    level = 400 << 8;
+    for(i = 0; i < TEST_SAMPLES; i++)
+    {
+        level += TEST_noise(4);
+        input[i] = TEST_clamp((level >> 8) + TEST_noise(1));
+    }
+    ec5 = TEST_roundTrip("ec5", input, TEST_SAMPLES);
+
+    // Batera: descarga de una cuenta cada 512 muestras, ruido de una cuenta
+    // en una de cada 16
+    for(i = 0; i < TEST_SAMPLES; i++)
+        input[i] = TEST_clamp(870 - i / 512 + ((TEST_random() & 0x0F) == 0 ? TEST_noise(1) : 0));
+    battery = TEST_roundTrip("battery", input, TEST_SAMPLES);
+
+    // Cotas de las tasas medidas, para detectar regresiones
+    TEST_CHECK(random >= 1.2);
+    TEST_CHECK(constant >= 40.0);
+    TEST_CHECK(ramp >= 4.5);
+    TEST_CHECK(step >= 20.0);
+    TEST_CHECK(ec5 >= 5.0);
+    TEST_CHECK(battery >= 20.0);
+
+    return(TEST_end());
+}
@@ -0,0 +1,127 @@
+/**
+  * @file     test_convert.c
+  * @brief    Prueba de las conversiones en punto fijo.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// test_convert.c - Compara convert.c con las frmulas en punto flotante para
+//                  todas las conversiones de 10 bits y varias tensiones de
+//                  alimentacin, e informa el error mximo.
+//
+// La batera se compara con la relacin real del divisor, (8200 + 2200) /
+// 2200 = 4.73. La expresin en float que reemplaz convert.c calculaba esa
+// divisin en enteros y escalaba por 4, es decir que lea un 15% menos.
+//
+// Tambin verifica que CONV_scaleBlock() (MPY32) y CONV_scaleBlockSoft()
+// den el mismo resultado y mide sus ciclos con CONV_benchmarkScale().
+//
+//*****************************************************************************
+
+#include <math.h>
+#include "msp430.h"
+#include "test.h"
+#include "convert.h"
+
+//*****************************************************************************
+//! @name Error mximo admitido (incluye el redondeo al entero del resultado):
+//! @{
+//*****************************************************************************
+#define MAX_SUPPLY_MV   0.51
+#define MAX_SENSOR_MV   0.51
+#define MAX_BATTERY_MV  1.0
+#define MAX_MPX_KPA     0.51
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+#define BLOCK 64
+
+static const uint16_t supplies[] = { 1800, 2200, 2700, 3000, 3300, 3600 };
+
+#define SUPPLIES (sizeof(supplies) / sizeof(supplies[0]))
+
+//*****************************************************************************
+static double TEST_max(const double max, const double error)
+{
+    return(fabs(error) > max ? fabs(error) : max);
+}
+//*****************************************************************************
+static void TEST_scale(void)
+{
+    static const int16_t gains[] = { CONV_SCALE_GAIN(3.3 / CONV_FULL_SCALE * 1000), CONV_SCALE_GAIN(1.0),
+                                     CONV_SCALE_GAIN(-2.5), 32767, -32768 };
+    static const int16_t offsets[] = { 0, 900, -1000, 32000, -32000 };
+    uint16_t raw[BLOCK];
+    int16_t hw[BLOCK], sw[BLOCK];
+    uint16_t hwCycles, swCycles;
+    uint16_t i, start;
+    uint8_t g, o, same = 1;
+
+    for(start = 0; start <= CONV_FULL_SCALE; start += BLOCK)
+    {
+        for(i = 0; i < BLOCK; i++)
+            raw[i] = (start + i) & CONV_FULL_SCALE;
+        for(g = 0; g < sizeof(gains) / sizeof(gains[0]); g++)
+            for(o = 0; o < sizeof(offsets) / sizeof(offsets[0]); o++)
+            {
+                CONV_scaleBlock(raw, hw, BLOCK, gains[g], offsets[o]);
+                CONV_scaleBlockSoft(raw, sw, BLOCK, gains[g], offsets[o]);
+                for(i = 0; i < BLOCK; i++)
+                    same &= hw[i] == sw[i];
+            }
+    }
+    TEST_CHECK(same);                       // Incluye la saturacin
+
+    // El modelo cuenta los accesos a registros, las llamadas y la rutina de
+    // multiplicacin del compilador
+    CONV_benchmarkScale(raw, hw, BLOCK, &hwCycles, &swCycles);
+    printf("scale: MPY32 %.1f cycles/sample, software %.1f cycles/sample\n",
+           (double)hwCycles / BLOCK, (double)swCycles / BLOCK);
+    TEST_CHECK(hwCycles > 0);
+    TEST_CHECK(swCycles > 4 * hwCycles);
+}
+//*****************************************************************************
+int main(void)
+{
+    double supplyError = 0, sensorError = 0, batteryError = 0, mpxError = 0;
+    double input;
+    uint16_t raw;
+    uint8_t s;
+
+    SIM_reset();
+
+    // Vref de 1.5 V: de 1.8 V a 3.6 V la conversin va de 426 a 853
+    for(raw = 400; raw <= CONV_FULL_SCALE; raw++)
+        supplyError = TEST_max(supplyError, CONV_supplyMillivolts(raw)
+                               - (1.5 * 1023) / raw * 1000);
+    TEST_CHECK(CONV_supplyMillivolts(0) == 0);
+
+    for(s = 0; s < SUPPLIES; s++)
+        for(raw = 0; raw <= CONV_FULL_SCALE; raw++)
+        {
+            input = (double)raw * supplies[s] / 1023;
+            sensorError = TEST_max(sensorError, CONV_sensorMillivolts(raw, supplies[s]) - input);
+            batteryError = TEST_max(batteryError, CONV_batteryMillivolts(raw, supplies[s])
+                                    - (input * (8200.0 + 2200.0) / 2200.0 + 900));
+        }
+
+    for(raw = 0; raw <= CONV_FULL_SCALE; raw++)
+        mpxError = TEST_max(mpxError, CONV_mpx5700Kpa(raw)
+                            - ((raw - 41.37) / (972.28 - 41.37)) * 700);
+
+    printf("max error: supply %.3f mV, sensor %.3f mV, battery %.3f mV, mpx5700 %.3f kPa\n",
+           supplyError, sensorError, batteryError, mpxError);
+
+    TEST_CHECK(supplyError <= MAX_SUPPLY_MV);
+    TEST_CHECK(sensorError <= MAX_SENSOR_MV);
+    TEST_CHECK(batteryError <= MAX_BATTERY_MV);
+    TEST_CHECK(mpxError <= MAX_MPX_KPA);
+
+    TEST_scale();
+
+    return(TEST_end());
+}
@@ -0,0 +1,255 @@
+/**
+  * @file     test_export.c
+  * @brief    Prueba de las tramas del exportador por UART.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// test_export.c - Captura lo que sale por UCA0TXD con SIM_onUartTx(), separa
+//                 las tramas en cada 0x00, deshace COBS y verifica el CRC-16
+//                 de cada una. Vuelca el registro desde el principio, desde
+//                 la mitad y desde una secuencia ya pisada luego de dar la
+//                 vuelta, y verifica que las secuencias lleguen consecutivas.
+//                 Por ltimo intercala EXPORT_send() y EXPORT_sendBlock()
+//                 con un volcado en curso.
+//
+//*****************************************************************************
+
+#include <string.h>
+#include "msp430.h"
+#include "test.h"
+#include "export.h"
+#include "codec.h"
+#include "log.h"
+
+#define TEST_LINE_SIZE 8192
+#define TEST_FRAMES    (LOG_RECORDS + 8)
+
+typedef struct TEST_frame
+{
+    uint8_t type;
+    uint8_t length;                         // Bytes de data, sin tipo ni CRC
+    uint8_t data[EXPORT_PAYLOAD_MAX];
+} TEST_frame;
+
+static uint8_t line[TEST_LINE_SIZE];
+static uint16_t lineLength;
+static TEST_frame frames[TEST_FRAMES];
+static uint16_t frameCount;
+static uint16_t badFrames;                  // COBS o CRC invlido
+static uint16_t sequence;                   // Prxima secuencia de TEST_append()
+
+//*****************************************************************************
+static void TEST_capture(const uint8_t data)
+{
+    if(lineLength < TEST_LINE_SIZE)
+        line[lineLength++] = data;
+}
+//*****************************************************************************
+// CRC-CCITT como el mdulo CRC: semilla 0xFFFF, cada byte desde el bit 0
+static uint16_t TEST_crc(const uint8_t* data, const uint16_t length)
+{
+    uint16_t crc = EXPORT_CRC_SEED;
+    uint16_t i;
+    uint8_t byte;
+    uint8_t bit;
+
+    for(i = 0; i < length; i++)
+        for(byte = data[i], bit = 0; bit < 8; bit++, byte >>= 1)
+            crc = ((crc >> 15) ^ (byte & 1)) ? (uint16_t)(crc << 1) ^ 0x1021 : (uint16_t)(crc << 1);
+
+    return(crc);
+}
+//*****************************************************************************
+// Deshace COBS de cada trama capturada y verifica su CRC
+static void TEST_parse(void)
+{
+    uint8_t decoded[EXPORT_FRAME_SIZE(EXPORT_PAYLOAD_MAX)];
+    uint16_t start = 0;
+    uint16_t end, position, n;
+    uint8_t code, i;
+
+    frameCount = 0;
+    badFrames = 0;
+    for(end = 0; end < lineLength; end++)
+    {
+        if(line[end] != 0x00)
+            continue;
+
+        n = 0;
+        for(position = start; position < end; )
+        {
+            code = line[position++];
+            for(i = 1; i < code && position < end && n < sizeof(decoded); i++)
+                decoded[n++] = line[position++];
+            if(position < end && n < sizeof(decoded))
+                decoded[n++] = 0x00;
+        }
+        start = end + 1;
+
+        if(n < 3 || n - 3 > EXPORT_PAYLOAD_MAX || frameCount == TEST_FRAMES ||
+           TEST_crc(decoded, n - 2) != (decoded[n - 2] | (uint16_t)decoded[n - 1] << 8))
+        {
+            badFrames++;
+            continue;
+        }
+        frames[frameCount].type = decoded[0];
+        frames[frameCount].length = n - 3;
+        memcpy(frames[frameCount].data, &decoded[1], n - 3);
+        frameCount++;
+    }
+
+    TEST_CHECK(start == lineLength);        // Sin bytes despus del ltimo 0x00
+}
+//*****************************************************************************
+// Espera a que salga el ltimo bit y separa las tramas. Sin EXPORT_sleep():
+// al terminar entra en LPM3 sin fuentes de despertar y el modelo se detiene
+static void TEST_drain(void)
+{
+    while(EXPORT_isDumping() || EXPORT_pending() || (UCA0STATW & UCBUSY))
+        __delay_cycles(100);
+
+    TEST_parse();
+    lineLength = 0;
+}
+//*****************************************************************************
+static void TEST_append(uint16_t count)
+{
+    uint16_t data[LOG_WORDS];
+    uint8_t w;
+
+    while(count--)
+    {
+        for(w = 0; w < LOG_WORDS; w++)
+            data[w] = sequence * 7 + w;
+        LOG_append(data, 1);
+        sequence++;
+    }
+}
+//*****************************************************************************
+// Las tramas EXPORT_RECORD llegan con secuencias consecutivas desde first,
+// cada una con su marca de commit y su CRC; devuelve cuntas
+static uint16_t TEST_records(const uint16_t first)
+{
+    LOG_record record;
+    uint16_t records = 0;
+    uint16_t i;
+
+    for(i = 0; i < frameCount; i++)
+    {
+        if(frames[i].type != EXPORT_RECORD)
+            continue;
+        memcpy(&record, frames[i].data, sizeof(record));
+        TEST_CHECK(frames[i].length == sizeof(LOG_record));
+        if(record.sequence != (uint16_t)(first + records) || record.commit != (uint16_t)~record.sequence ||
+           record.type != LOG_MEASURE || record.data[1] != (uint16_t)(record.sequence * 7 + 1))
+            break;
+        records++;
+    }
+
+    return(records);
+}
+//*****************************************************************************
+// Todo el registro y luego desde la mitad
+static void TEST_dump(void)
+{
+    uint16_t first;
+
+    TEST_append(20);
+    first = LOG_firstSequence();
+    TEST_CHECK(LOG_count() == 20);
+
+    TEST_CHECK(EXPORT_dump(first) == STATUS_SUCCESS);
+    TEST_drain();
+    TEST_CHECK(badFrames == 0);
+    TEST_CHECK(frameCount == 20);
+    TEST_CHECK(TEST_records(first) == 20);
+    TEST_CHECK(EXPORT_dumpPosition() == (uint16_t)(first + 20));
+
+    // Retoma desde la siguiente a la ltima recibida
+    TEST_CHECK(EXPORT_dump(first + 12) == STATUS_SUCCESS);
+    TEST_drain();
+    TEST_CHECK(badFrames == 0);
+    TEST_CHECK(frameCount == 8);
+    TEST_CHECK(TEST_records(first + 12) == 8);
+}
+//*****************************************************************************
+// Una secuencia que se pis al dar la vuelta arranca por la ms antigua
+static void TEST_dumpWrapped(void)
+{
+    uint16_t old = LOG_firstSequence();
+
+    TEST_append(LOG_RECORDS + 30);
+    TEST_CHECK(LOG_count() == LOG_RECORDS);
+    TEST_CHECK((int16_t)(LOG_firstSequence() - old) > 0);
+
+    TEST_CHECK(EXPORT_dump(old) == STATUS_SUCCESS);
+    TEST_drain();
+    TEST_CHECK(badFrames == 0);
+    TEST_CHECK(frameCount == LOG_RECORDS);
+    TEST_CHECK(TEST_records(LOG_firstSequence()) == LOG_RECORDS);
+    TEST_CHECK(EXPORT_dumpPosition() == sequence);
+}
+//*****************************************************************************
+// EXPORT_send() y EXPORT_sendBlock() durante un volcado: entran entre dos
+// registros y el volcado sigue sin saltear secuencias
+static void TEST_interleave(void)
+{
+    uint8_t block[CODEC_BLOCK_SIZE];
+    uint16_t samples[CODEC_BLOCK_SAMPLES];
+    uint16_t decoded[CODEC_BLOCK_SAMPLES];
+    uint16_t measure[LOG_WORDS] = { 0x0000, 0x1234, 0x00FF, 0xFF00 };
+    CODEC_encoder encoder;
+    uint16_t length;
+    uint16_t i, m = 0, b = 0;
+
+    CODEC_initEncoder(&encoder, block, sizeof(block));
+    for(i = 0; i < CODEC_BLOCK_SAMPLES; i++)
+    {
+        samples[i] = 700 + (i & 3) - (i & 1);
+        TEST_CHECK(CODEC_put(&encoder, samples[i]) == STATUS_SUCCESS);
+    }
+    length = CODEC_finish(&encoder);
+
+    TEST_CHECK(EXPORT_dump(LOG_firstSequence()) == STATUS_SUCCESS);
+    __delay_cycles(SIM_MCLK_HZ / 100);      // Unos registros ya salieron
+    TEST_CHECK(EXPORT_send(EXPORT_MEASURE, (const uint8_t*)measure, sizeof(measure)) == STATUS_SUCCESS);
+    TEST_CHECK(EXPORT_sendBlock(block, length) == STATUS_SUCCESS);
+    TEST_CHECK(EXPORT_sendBlock(block, 0) == STATUS_FAIL);
+    TEST_drain();
+
+    TEST_CHECK(badFrames == 0);
+    TEST_CHECK(frameCount == LOG_RECORDS + 2);
+    TEST_CHECK(TEST_records(LOG_firstSequence()) == LOG_RECORDS);
+    for(i = 0; i < frameCount; i++)
+    {
+        if(frames[i].type == EXPORT_MEASURE)
+            m = i;
+        if(frames[i].type == EXPORT_BLOCK)
+            b = i;
+    }
+    TEST_CHECK(m > 0 && b == m + 1 && b < frameCount - 1);
+    TEST_CHECK(frames[m].length == sizeof(measure) && memcmp(frames[m].data, measure, sizeof(measure)) == 0);
+    TEST_CHECK(frames[b].length == length);
+    TEST_CHECK(CODEC_decode(frames[b].data, frames[b].length, decoded, CODEC_BLOCK_SAMPLES) == CODEC_BLOCK_SAMPLES);
+    TEST_CHECK(memcmp(decoded, samples, sizeof(samples)) == 0);
+}
+//*****************************************************************************
+int main(void)
+{
+    SIM_reset();
+    SIM_onUartTx(TEST_capture);
+    PM5CTL0 &= ~LOCKLPM5;
+
+    LOG_init();
+    TEST_CHECK(EXPORT_init(EXPORT_BAUD) == STATUS_SUCCESS);
+    __enable_interrupt();
+
+    TEST_dump();
+    TEST_dumpWrapped();
+    TEST_interleave();
+
+    return(TEST_end());
+}
@@ -0,0 +1,107 @@
+/**
+  * @file     test_gpio.c
+  * @brief    Prueba y costo del encendido de sensores.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// test_gpio.c - Verifica el estado de los pines y compara los ciclos de
+//               encender y apagar un sensor con GPIO_powerOnSensor() (pin
+//               resuelto en ejecucin), GPIO_POWER_ON() y GPIO_SET_PIN().
+//               El modelo cuenta llamadas y accesos a registros.
+//
+//*****************************************************************************
+
+#include "msp430.h"
+#include "test.h"
+#include "gpio.h"
+
+#define PIN_MASK    (BIT6 << 8)             // P6.6 en la parte alta de PC
+
+static const GPIO_pin pin = GPIO_PIN(6, 6);
+
+//*****************************************************************************
+static uint32_t TEST_cycles(void)
+{
+    SIM_counters counters;
+
+    SIM_getCounters(&counters);
+
+    return((uint32_t)counters.activeCycles);
+}
+//*****************************************************************************
+static uint8_t TEST_isOutput(const uint8_t high)
+{
+    uint16_t dir = HWREG16(GPIO_PORT_BASE(6) + OFS_PADIR);
+    uint16_t out = HWREG16(GPIO_PORT_BASE(6) + OFS_PAOUT);
+
+    return((dir & PIN_MASK) && ((out & PIN_MASK) != 0) == high);
+}
+//*****************************************************************************
+int main(void)
+{
+    uint32_t start, runtime, constant, resolved, set;
+
+    SIM_reset();
+
+    // Resolucin en compilacin igual a GPIO_configPins()
+    TEST_CHECK(pin.base == 0x0240 && pin.mask == PIN_MASK);
+    TEST_CHECK(GPIO_PORT_BASE(1) == 0x0200 && GPIO_PIN_MASK(1, 0) == 0x0001);
+    TEST_CHECK(GPIO_PORT_BASE(8) == 0x0260 && GPIO_PIN_MASK(8, 7) == 0x8000);
+
+    // Resuelto en ejecucin
+    start = TEST_cycles();
+    GPIO_powerOnSensor(6, 6);
+    runtime = TEST_cycles() - start;
+    TEST_CHECK(TEST_isOutput(1));
+    start = TEST_cycles();
+    GPIO_powerOffSensor(6, 6);
+    runtime += TEST_cycles() - start;
+    TEST_CHECK(TEST_isOutput(0));
+
+    // Con pull-up previo: la salida no depende de PxREN
+    GPIO_setPinWithPullUpResistor(GPIO_PORT_BASE(6), PIN_MASK);
+
+    // Pin constante
+    start = TEST_cycles();
+    GPIO_POWER_ON(6, 6);
+    constant = TEST_cycles() - start;
+    TEST_CHECK(TEST_isOutput(1));
+    start = TEST_cycles();
+    GPIO_POWER_OFF(6, 6);
+    constant += TEST_cycles() - start;
+    TEST_CHECK(TEST_isOutput(0));
+
+    // Pin de la tabla de sensores
+    start = TEST_cycles();
+    GPIO_powerOn(&pin);
+    resolved = TEST_cycles() - start;
+    TEST_CHECK(TEST_isOutput(1));
+    start = TEST_cycles();
+    GPIO_powerOff(&pin);
+    resolved += TEST_cycles() - start;
+    TEST_CHECK(TEST_isOutput(0));
+
+    // Pin ya configurado como salida
+    start = TEST_cycles();
+    GPIO_SET_PIN(6, 6);
+    set = TEST_cycles() - start;
+    TEST_CHECK(TEST_isOutput(1));
+    start = TEST_cycles();
+    GPIO_CLEAR_PIN(6, 6);
+    set += TEST_cycles() - start;
+    TEST_CHECK(TEST_isOutput(0));
+
+    printf("on+off: GPIO_powerOnSensor %lu cycles, GPIO_POWER_ON %lu, GPIO_powerOn %lu, GPIO_SET_PIN %lu\n",
+           (unsigned long)runtime, (unsigned long)constant, (unsigned long)resolved, (unsigned long)set);
+
+    // Dos escrituras por cambio, una si ya es salida; el BIS de PxDIR que no
+    // cambia el valor tambin es una escritura
+    TEST_CHECK(constant == 4 * SIM_WRITE_CYCLES);
+    TEST_CHECK(resolved == 4 * SIM_WRITE_CYCLES);
+    TEST_CHECK(set == 2 * SIM_WRITE_CYCLES);
+
+    return(TEST_end());
+}
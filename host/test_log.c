@@ -0,0 +1,259 @@
+/**
+  * @file     test_log.c
+  * @brief    Prueba del registro circular en FRAM ante cortes y daos.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// test_log.c - Corta la alimentacin en medio de un FRAMCtl_write16() de
+//              LOG_append() luego de dar la vuelta a la regin, vuelve a
+//              ejecutar LOG_init() y verifica la posicin, la cantidad y la
+//              primera secuencia. Luego invierte un bit de datos en la FRAM
+//              y verifica que LOG_read() lo rechace sin afectar a los
+//              vecinos. Por ltimo guarda bloques de CODEC_finish() con
+//              LOG_appendBlock() y los decodifica desde la FRAM.
+//
+//              El Makefile enlaza esta prueba con
+//              -Wl,--wrap=FRAMCtl_write16: el corte escribe las primeras
+//              cutWords palabras y vuelve a main() con longjmp(), como un
+//              reset que pierde la RAM.
+//
+//*****************************************************************************
+
+#include <setjmp.h>
+#include <string.h>
+#include "msp430.h"
+#include "test.h"
+#include "log.h"
+#include "codec.h"
+
+#define TEST_SAMPLES 256
+
+static jmp_buf powerLoss;
+static int16_t cutWords = -1;        // Palabras hasta el corte, -1: sin corte
+
+void __real_FRAMCtl_write16(uint16_t* dataPtr, uint16_t* framPtr, uint16_t numberOfWords);
+
+//*****************************************************************************
+void __wrap_FRAMCtl_write16(uint16_t* dataPtr, uint16_t* framPtr, uint16_t numberOfWords)
+{
+    if(cutWords < 0 || cutWords >= numberOfWords)
+    {
+        __real_FRAMCtl_write16(dataPtr, framPtr, numberOfWords);
+        if(cutWords >= 0)
+            cutWords -= numberOfWords;
+        return;
+    }
+
+    __real_FRAMCtl_write16(dataPtr, framPtr, cutWords);
+    cutWords = -1;
+    longjmp(powerLoss, 1);
+}
+//*****************************************************************************
+// Datos de un registro, derivados de su secuencia
+static void TEST_fill(uint16_t* data, uint16_t sequence, const uint16_t count)
+{
+    uint16_t i;
+    uint8_t w;
+
+    for(i = 0; i < count; i++, sequence++)
+        for(w = 0; w < LOG_WORDS; w++)
+            *data++ = (uint16_t)(sequence * 31 + w) ^ 0xA5C3;
+}
+//*****************************************************************************
+static void TEST_append(const uint16_t sequence, const uint16_t count)
+{
+    uint16_t data[LOG_BLOCK_RECORDS * LOG_WORDS];
+
+    TEST_fill(data, sequence, count);
+    LOG_append(data, count);
+}
+//*****************************************************************************
+// Todos los registros se leen, consecutivos desde LOG_firstSequence()
+static uint8_t TEST_intact(void)
+{
+    uint16_t expected[LOG_WORDS];
+    const LOG_record* record;
+    uint16_t first = LOG_firstSequence();
+    uint16_t i;
+    uint8_t w;
+
+    for(i = 0; i < LOG_count(); i++)
+    {
+        record = LOG_read(i);
+        if(record == 0 || record->sequence != (uint16_t)(first + i) || record->type != LOG_MEASURE)
+            return(0);
+        TEST_fill(expected, first + i, 1);
+        for(w = 0; w < LOG_WORDS; w++)
+            if(record->data[w] != expected[w])
+                return(0);
+    }
+
+    return(1);
+}
+//*****************************************************************************
+// Regin con la vuelta dada y un corte a mitad de un bloque: el primer
+// registro queda completo y del segundo solo se escribi la secuencia
+static void TEST_brownout(void)
+{
+    const LOG_record* area;
+    uint16_t sequence = 0;
+
+    LOG_init();
+    TEST_CHECK(LOG_count() == 0);
+
+    // Vuelta y media a la regin, en bloques de distinto tamao
+    while(sequence < LOG_RECORDS + LOG_RECORDS / 2)
+    {
+        TEST_append(sequence, 1 + sequence % LOG_BLOCK_RECORDS);
+        sequence += 1 + sequence % LOG_BLOCK_RECORDS;
+    }
+    TEST_CHECK(LOG_count() == LOG_RECORDS);
+    TEST_CHECK(LOG_firstSequence() == (uint16_t)(sequence - LOG_RECORDS));
+    TEST_CHECK(TEST_intact());
+
+    // La secuencia s ocupa la posicin s % LOG_RECORDS de la regin
+    area = LOG_read(0) - LOG_firstSequence() % LOG_RECORDS;
+
+    cutWords = LOG_RECORD_WORDS + 1;
+    if(setjmp(powerLoss) == 0)
+    {
+        TEST_append(sequence, 4);
+        TEST_CHECK(0);                      // No debe llegar
+    }
+
+    // Reset: la RAM se reconstruye desde la FRAM
+    LOG_init();
+    TEST_CHECK(LOG_count() == LOG_RECORDS - 1);
+    TEST_CHECK(LOG_firstSequence() == (uint16_t)(sequence + 1 - (LOG_RECORDS - 1)));
+    TEST_CHECK(LOG_read(LOG_count() - 1)->sequence == sequence);
+    TEST_CHECK(LOG_find(sequence + 1) == 0);
+    TEST_CHECK(TEST_intact());
+    sequence++;
+
+    // La posicin de escritura es la del registro que qued a medias
+    TEST_append(sequence, 1);
+    TEST_CHECK(LOG_count() == LOG_RECORDS);
+    TEST_CHECK(LOG_find(sequence) == &area[sequence % LOG_RECORDS]);
+    TEST_CHECK(LOG_read(LOG_RECORDS - 1) == &area[sequence % LOG_RECORDS]);
+    TEST_CHECK(TEST_intact());
+}
+//*****************************************************************************
+// Un bit de datos invertido: el CRC rechaza el registro, la marca de commit
+// sigue siendo vlida y los vecinos se leen
+static void TEST_bitFlip(void)
+{
+    const uint16_t index = LOG_RECORDS / 2;
+    LOG_record* record = (LOG_record*)LOG_read(index);
+    uint16_t count = LOG_count();
+
+    TEST_CHECK(record != 0);
+    record->data[2] ^= 0x0100;
+
+    TEST_CHECK(LOG_read(index) == 0);
+    TEST_CHECK(LOG_read(index - 1) != 0);
+    TEST_CHECK(LOG_read(index + 1) != 0);
+    TEST_CHECK(LOG_find(record->sequence) == record);
+
+    // La marca de commit no cambi: LOG_init() no pierde registros
+    LOG_init();
+    TEST_CHECK(LOG_count() == count);
+    TEST_CHECK(LOG_read(index) == 0);
+    TEST_CHECK(LOG_read(index - 1) != 0 && LOG_read(index + 1) != 0);
+
+    record->data[2] ^= 0x0100;
+    TEST_CHECK(LOG_read(index) == record);
+}
+//*****************************************************************************
+// Guarda un bloque y devuelve la secuencia de su primer registro
+static uint16_t TEST_appendBlock(CODEC_encoder* encoder)
+{
+    uint16_t sequence = LOG_firstSequence() + LOG_count();
+    uint16_t length = CODEC_finish(encoder);
+
+    LOG_appendBlock(encoder->data, length);
+    TEST_CHECK((uint16_t)(LOG_firstSequence() + LOG_count() - sequence) == (length + LOG_BYTES - 1) / LOG_BYTES);
+
+    return(sequence);
+}
+//*****************************************************************************
+// Bloques comprimidos entre mediciones: cada uno se lee de la FRAM y se
+// decodifica igual a la entrada; un corte a mitad de un bloque lo descarta
+static void TEST_blocks(void)
+{
+    static uint16_t samples[TEST_SAMPLES];
+    uint16_t decoded[CODEC_BLOCK_SAMPLES];
+    uint16_t sequence[TEST_SAMPLES / 8];
+    uint16_t start[TEST_SAMPLES / 8];
+    uint8_t block[CODEC_BLOCK_SIZE];
+    uint8_t stored[CODEC_BLOCK_SIZE];
+    CODEC_encoder encoder;
+    uint32_t seed = 1;
+    uint16_t blocks = 0;
+    uint16_t i, index, count;
+    uint8_t length;
+
+    // Seal lenta con 1 cuenta de ruido
+    for(i = 0; i < TEST_SAMPLES; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        samples[i] = 500 + i / 32 + (uint16_t)((seed >> 16) % 3) - 1;
+    }
+
+    start[0] = 0;
+    CODEC_initEncoder(&encoder, block, sizeof(block));
+    for(i = 0; i < TEST_SAMPLES; i++)
+    {
+        if(CODEC_put(&encoder, samples[i]) == STATUS_FAIL)
+        {
+            sequence[blocks++] = TEST_appendBlock(&encoder);
+            TEST_append(LOG_firstSequence() + LOG_count(), 1);
+            start[blocks] = i;
+            CODEC_initEncoder(&encoder, block, sizeof(block));
+            CODEC_put(&encoder, samples[i]);
+        }
+    }
+    sequence[blocks++] = TEST_appendBlock(&encoder);
+    start[blocks] = TEST_SAMPLES;
+
+    for(i = 0; i < blocks; i++)
+    {
+        index = sequence[i] - LOG_firstSequence();
+        length = LOG_readBlock(index, stored, sizeof(stored));
+        TEST_CHECK(length != 0);
+        TEST_CHECK(LOG_readBlock(index + 1, stored, sizeof(stored)) == 0);
+        count = CODEC_decode(stored, length, decoded, CODEC_BLOCK_SAMPLES);
+        TEST_CHECK(count == start[i + 1] - start[i]);
+        TEST_CHECK(memcmp(decoded, &samples[start[i]], count * sizeof(uint16_t)) == 0);
+    }
+    TEST_CHECK(LOG_readBlock(sequence[0] - LOG_firstSequence(), stored, LOG_BYTES) == 0);
+
+    // Corte luego de escribir dos registros del bloque
+    CODEC_initEncoder(&encoder, block, sizeof(block));
+    for(i = 0; CODEC_put(&encoder, samples[i] ^ (i & 4 ? 0x0055 : 0)) == STATUS_SUCCESS; i++)
+        ;
+    TEST_CHECK(CODEC_finish(&encoder) > 2 * LOG_BYTES);
+    cutWords = 2 * LOG_RECORD_WORDS + 3;
+    if(setjmp(powerLoss) == 0)
+    {
+        TEST_appendBlock(&encoder);
+        TEST_CHECK(0);                      // No debe llegar
+    }
+    LOG_init();
+    TEST_CHECK(LOG_readBlock(LOG_count() - 2, stored, sizeof(stored)) == 0);
+    index = sequence[blocks - 1] - LOG_firstSequence();
+    TEST_CHECK(LOG_readBlock(index, stored, sizeof(stored)) != 0);
+}
+//*****************************************************************************
+int main(void)
+{
+    SIM_reset();
+
+    TEST_brownout();
+    TEST_bitFlip();
+    TEST_blocks();
+
+    return(TEST_end());
+}
@@ -0,0 +1,164 @@
+/**
+  * @file     test_ringbuf.c
+  * @brief    Prueba del buffer circular.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// test_ringbuf.c - Vaco, lleno, conteo de descartes y desborde de los
+//                  ndices ms all de 0xFFFF. Lo mismo para el buffer de
+//                  bytes.
+//
+//*****************************************************************************
+
+#include "msp430.h"
+#include "test.h"
+#include "ringbuf.h"
+
+#define SIZE 8
+
+static uint16_t data[SIZE];
+static RINGBUF_buffer ring;
+static uint8_t bytes[SIZE];
+static RINGBUF_bytes byteRing;
+
+//*****************************************************************************
+static void TEST_empty(void)
+{
+    uint16_t value = 0x5555;
+
+    RINGBUF_init(&ring, data, SIZE);
+    TEST_CHECK(RINGBUF_count(&ring) == 0);
+    TEST_CHECK(RINGBUF_get(&ring, &value) == STATUS_FAIL);
+    TEST_CHECK(value == 0x5555);            // No se modifica
+
+    TEST_CHECK(RINGBUF_put(&ring, 7) == STATUS_SUCCESS);
+    TEST_CHECK(RINGBUF_count(&ring) == 1);
+    TEST_CHECK(RINGBUF_get(&ring, &value) == STATUS_SUCCESS && value == 7);
+    TEST_CHECK(RINGBUF_get(&ring, &value) == STATUS_FAIL);
+}
+//*****************************************************************************
+static void TEST_full(void)
+{
+    uint16_t value;
+    uint16_t i;
+
+    RINGBUF_init(&ring, data, SIZE);
+    for(i = 0; i < SIZE; i++)
+        TEST_CHECK(RINGBUF_put(&ring, 100 + i) == STATUS_SUCCESS);
+    TEST_CHECK(RINGBUF_count(&ring) == SIZE);
+
+    // Lleno: se descarta sin pisar la ms antigua
+    TEST_CHECK(RINGBUF_put(&ring, 999) == STATUS_FAIL);
+    TEST_CHECK(RINGBUF_count(&ring) == SIZE);
+    for(i = 0; i < SIZE; i++)
+        TEST_CHECK(RINGBUF_get(&ring, &value) == STATUS_SUCCESS && value == 100 + i);
+    TEST_CHECK(RINGBUF_count(&ring) == 0);
+}
+//*****************************************************************************
+static void TEST_overruns(void)
+{
+    uint16_t value;
+    uint16_t i;
+
+    RINGBUF_init(&ring, data, SIZE);
+    TEST_CHECK(RINGBUF_takeOverruns(&ring) == 0);
+    for(i = 0; i < SIZE + 5; i++)
+        RINGBUF_put(&ring, i);
+    TEST_CHECK(RINGBUF_takeOverruns(&ring) == 5);
+    TEST_CHECK(RINGBUF_takeOverruns(&ring) == 0);
+
+    // Con lugar libre deja de contar
+    RINGBUF_get(&ring, &value);
+    TEST_CHECK(RINGBUF_put(&ring, 1) == STATUS_SUCCESS);
+    TEST_CHECK(RINGBUF_put(&ring, 2) == STATUS_FAIL);
+    TEST_CHECK(RINGBUF_takeOverruns(&ring) == 1);
+
+    // GIE se conserva
+    __enable_interrupt();
+    RINGBUF_put(&ring, 3);
+    RINGBUF_takeOverruns(&ring);
+    TEST_CHECK(__get_SR_register() & GIE);
+    __disable_interrupt();
+    RINGBUF_put(&ring, 3);
+    RINGBUF_takeOverruns(&ring);
+    TEST_CHECK(!(__get_SR_register() & GIE));
+}
+//*****************************************************************************
+static void TEST_wrap(void)
+{
+    uint16_t value;
+    uint16_t i;
+    uint16_t next = 0;
+    uint8_t ok = 1;
+
+    // ndices a punto de desbordar
+    RINGBUF_init(&ring, data, SIZE);
+    ring.head = ring.tail = 0xFFFC;
+
+    for(i = 0; i < 3 * SIZE; i++)
+    {
+        if(RINGBUF_put(&ring, i) != STATUS_SUCCESS)
+            ok = 0;
+        if(i % 2)
+        {
+            // Consume de a dos, con el buffer a medias al cruzar 0xFFFF
+            ok &= RINGBUF_get(&ring, &value) == STATUS_SUCCESS && value == next++;
+            ok &= RINGBUF_get(&ring, &value) == STATUS_SUCCESS && value == next++;
+        }
+        if(RINGBUF_count(&ring) > 1)
+            ok = 0;
+    }
+    TEST_CHECK(ok);
+    TEST_CHECK(ring.head < 0xFFFC);         // Cruz 0xFFFF
+
+    // Lleno justo sobre el desborde
+    ring.head = ring.tail = 0xFFFE;
+    for(i = 0; i < SIZE; i++)
+        TEST_CHECK(RINGBUF_put(&ring, i) == STATUS_SUCCESS);
+    TEST_CHECK(RINGBUF_count(&ring) == SIZE);
+    TEST_CHECK(RINGBUF_put(&ring, 0) == STATUS_FAIL);
+    for(i = 0; i < SIZE; i++)
+        TEST_CHECK(RINGBUF_get(&ring, &value) == STATUS_SUCCESS && value == i);
+    TEST_CHECK(RINGBUF_get(&ring, &value) == STATUS_FAIL);
+}
+//*****************************************************************************
+static void TEST_bytes(void)
+{
+    uint8_t value = 0x55;
+    uint16_t i;
+
+    RINGBUF_initBytes(&byteRing, bytes, SIZE);
+    TEST_CHECK(RINGBUF_countBytes(&byteRing) == 0);
+    TEST_CHECK(RINGBUF_getByte(&byteRing, &value) == STATUS_FAIL);
+    TEST_CHECK(value == 0x55);
+
+    // Lleno justo sobre el desborde de los ndices
+    byteRing.head = byteRing.tail = 0xFFFE;
+    for(i = 0; i < SIZE; i++)
+        TEST_CHECK(RINGBUF_putByte(&byteRing, 0xF8 + i) == STATUS_SUCCESS);
+    TEST_CHECK(RINGBUF_countBytes(&byteRing) == SIZE);
+    TEST_CHECK(RINGBUF_putByte(&byteRing, 0) == STATUS_FAIL);
+    for(i = 0; i < SIZE; i++)
+        TEST_CHECK(RINGBUF_getByte(&byteRing, &value) == STATUS_SUCCESS && value == 0xF8 + i);
+    TEST_CHECK(RINGBUF_getByte(&byteRing, &value) == STATUS_FAIL);
+    TEST_CHECK(RINGBUF_countBytes(&byteRing) == 0);
+
+    // Un byte por posicin
+    TEST_CHECK(sizeof(bytes) == SIZE);
+}
+//*****************************************************************************
+int main(void)
+{
+    SIM_reset();
+
+    TEST_empty();
+    TEST_full();
+    TEST_overruns();
+    TEST_wrap();
+    TEST_bytes();
+
+    return(TEST_end());
+}
@@ -0,0 +1,118 @@
+/**
+  * @file     test_timer.c
+  * @brief    Prueba de los temporizadores por software.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// test_timer.c - Verifica que un temporizador vencido con las interrupciones
+//                deshabilitadas se atiende al rearmar la cola y que ningn
+//                temporizador vence antes de lo pedido. Un temporizador que
+//                despierta a la CPU no debe terminar una espera del ADC.
+//                El modelo cobra 32 ciclos de MCLK por cuenta de ACLK.
+//
+//*****************************************************************************
+
+#include "msp430.h"
+#include "test.h"
+#include "timer.h"
+#include "delay.h"
+#include "adccc.h"
+
+static uint16_t fired;               // TA0R al vencer, sin la demora de TIMER_getTime()
+
+//*****************************************************************************
+static uint8_t TEST_record(TIMER_handle* timer)
+{
+    fired = TA0R;
+
+    return(TIMER_WAKE);
+}
+//*****************************************************************************
+// Un temporizador que vence sin GIE no debe retrasar al siguiente hasta el
+// desborde del TA0R
+static void TEST_pastDue(void)
+{
+    TIMER_handle late = {0};
+    uint32_t start, elapsed, baseline;
+
+    delay_init();
+
+    // Referencia sin temporizadores en la cola
+    start = TIMER_getTime();
+    delay_ms(1);
+    baseline = TIMER_getTime() - start;
+
+    __disable_interrupt();
+    start = TIMER_getTime();
+    TIMER_start(&late, 50, 0, 0);
+    while(TIMER_getTime() - start < 100)
+        __delay_cycles(100);
+
+    start = TIMER_getTime();
+    delay_ms(1);
+    elapsed = TIMER_getTime() - start;
+
+    printf("delay_ms(1): %lu ticks, after a past-due timer %lu\n", (unsigned long)baseline, (unsigned long)elapsed);
+    TEST_CHECK(!late.running);
+    TEST_CHECK(elapsed >= TIMER_MS(1) && elapsed <= baseline + TIMER_MARGIN);
+}
+//*****************************************************************************
+// El segundo queda a 1..4 * TIMER_MARGIN cuentas al habilitar las
+// interrupciones; segn la demora de la interrupcin alguno queda a menos de
+// TIMER_MARGIN al atender el primero y no debe adelantarse
+static void TEST_neverEarly(void)
+{
+    TIMER_handle first = {0};
+    TIMER_handle second = {0};
+    uint8_t lead;
+
+    for(lead = 1; lead <= 4 * TIMER_MARGIN; lead++)
+    {
+        __disable_interrupt();
+        TIMER_start(&first, 20, 0, 0);
+        TIMER_start(&second, 40, 0, TEST_record);
+        while((int16_t)((uint16_t)second.expiry - TA0R) > lead)
+            ;
+
+        TIMER_wait(&second);
+
+        TEST_CHECK(!first.running);
+        TEST_CHECK((int16_t)(fired - (uint16_t)second.expiry) >= 0);
+    }
+}
+//*****************************************************************************
+// Un temporizador peridico despierta a la CPU varias veces durante el
+// muestreo; ADC_samplePeriodic() debe volver con todas las muestras
+static void TEST_adcWait(void)
+{
+    TIMER_handle tick = {0};
+    uint16_t samples[8];
+    uint8_t i, filled = 1;
+
+    SIM_setInput(2, 1000);
+    for(i = 0; i < 8; i++)
+        samples[i] = 0xFFFF;
+
+    TIMER_start(&tick, 20, 20, TEST_record);
+    ADC_samplePeriodic(2, 32, samples, 8);
+    TIMER_stop(&tick);
+    __enable_interrupt();
+
+    for(i = 0; i < 8; i++)
+        filled &= samples[i] != 0xFFFF;
+    TEST_CHECK(filled);
+}
+//*****************************************************************************
+int main(void)
+{
+    SIM_reset();
+
+    TEST_pastDue();
+    TEST_neverEarly();
+    TEST_adcWait();
+
+    return(TEST_end());
+}
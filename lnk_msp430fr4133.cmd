@@ -58,7 +58,8 @@ MEMORY
     PERIPHERALS_16BIT       : origin = 0x0100, length = 0x0100
     RAM                     : origin = 0x2000, length = 0x0800
     INFOA                   : origin = 0x1800, length = 0x0200
-    FRAM                    : origin = 0xC400, length = 0x3B80
+    FRAM                    : origin = 0xC400, length = 0x3380
+    LOG                     : origin = 0xF780, length = 0x0800  /* log.c, LOG_BASE y LOG_SIZE */
     JTAGSIGNATURE           : origin = 0xFF80, length = 0x0004, fill = 0xFFFF
     BSLSIGNATURE            : origin = 0xFF84, length = 0x0004, fill = 0xFFFF
     INT00                   : origin = 0xFF88, length = 0x0002
@@ -0,0 +1,243 @@
+/*
+ * log.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Matas Lpez - Jess Lpez
+ */
+//*****************************************************************************
+//
+// log.c - Registro circular de mediciones en FRAM.
+//
+//*****************************************************************************
+
+#include "log.h"
+
+//*****************************************************************************
+//                              Variables
+//*****************************************************************************
+// Region LOG de la FRAM, no se inicializa al arrancar
+#if defined(__TI_COMPILER_VERSION__)
+#pragma LOCATION(logArea, LOG_BASE)
+#pragma NOINIT(logArea)
+static LOG_record logArea[LOG_RECORDS];
+#elif defined(__IAR_SYSTEMS_ICC__)
+__no_init static LOG_record logArea[LOG_RECORDS] @ LOG_BASE;
+#elif defined(__GNUC__) && defined(__MSP430__)
+static LOG_record logArea[LOG_RECORDS] __attribute__((section(".log")));
+#else
+static LOG_record logArea[LOG_RECORDS];
+#endif
+
+static uint16_t logHead;                    // Proxima posicion a escribir
+static uint16_t logSequence;                // Secuencia del proximo registro
+static uint16_t logCount;                   // Registros validos
+
+//*****************************************************************************
+static inline uint8_t LOG_isValid(const LOG_record* record)
+{
+    return(record->commit == (uint16_t)~record->sequence);
+}
+//*****************************************************************************
+static uint16_t LOG_crc(const LOG_record* record)
+{
+    uint8_t w;
+
+    CRC_setSeed(CRC_BASE, LOG_CRC_SEED);
+    CRC_set16BitData(CRC_BASE, record->sequence);
+    CRC_set8BitData(CRC_BASE, record->type);
+    CRC_set8BitData(CRC_BASE, record->length);
+    for(w = 0; w < LOG_WORDS; w++)
+        CRC_set16BitData(CRC_BASE, record->data[w]);
+
+    return(CRC_getResult(CRC_BASE));
+}
+//*****************************************************************************
+void LOG_init(void)
+{
+    uint16_t newest = LOG_RECORDS;
+    uint16_t previous;
+    uint16_t slot;
+
+    // Ultimo registro: el valido de mayor secuencia
+    for(slot = 0; slot < LOG_RECORDS; slot++)
+        if(LOG_isValid(&logArea[slot]) && (newest == LOG_RECORDS ||
+           (int16_t)(logArea[slot].sequence - logArea[newest].sequence) > 0))
+            newest = slot;
+
+    logHead = 0;
+    logSequence = 0;
+    logCount = 0;
+    if(newest == LOG_RECORDS)
+        return;                             // Region vacia
+
+    logHead = (newest + 1 == LOG_RECORDS) ? 0 : newest + 1;
+    logSequence = logArea[newest].sequence + 1;
+
+    // Registros consecutivos hacia atras
+    slot = newest;
+    do
+    {
+        logCount++;
+        previous = slot ? slot - 1 : LOG_RECORDS - 1;
+        if(!LOG_isValid(&logArea[previous]) ||
+           logArea[previous].sequence != (uint16_t)(logArea[slot].sequence - 1))
+            break;
+        slot = previous;
+    } while(logCount < LOG_RECORDS);
+}
+//*****************************************************************************
+static void LOG_write(const uint8_t* data, uint16_t bytes, const uint8_t type,
+                      const uint8_t length)
+{
+    LOG_record block[LOG_BLOCK_RECORDS];
+    uint16_t sequence = logSequence;
+    uint16_t count = (bytes + LOG_BYTES - 1) / LOG_BYTES;
+    uint16_t chunk;
+    uint16_t gie;
+    uint8_t next = type;
+    uint8_t i;
+    uint8_t b;
+
+    while(count)
+    {
+        chunk = count;
+        if(chunk > LOG_BLOCK_RECORDS)
+            chunk = LOG_BLOCK_RECORDS;
+        if(chunk > LOG_RECORDS - logHead)
+            chunk = LOG_RECORDS - logHead;
+
+        // Secuencia primero, marca de commit al final de cada registro
+        for(i = 0; i < chunk; i++)
+        {
+            block[i].sequence = sequence;
+            block[i].type = next;
+            block[i].length = length;
+            for(b = 0; b < LOG_BYTES; b++)
+            {
+                ((uint8_t*)block[i].data)[b] = bytes ? *data++ : 0;
+                if(bytes)
+                    bytes--;
+            }
+            block[i].crc = LOG_crc(&block[i]);
+            block[i].commit = ~sequence;
+            sequence++;
+            if(type == LOG_BLOCK)
+                next = LOG_BLOCK_NEXT;
+        }
+
+        // Un solo cambio de la proteccion de escritura por bloque
+        FRAMCtl_write16((uint16_t*)block, (uint16_t*)&logArea[logHead],
+                        chunk * LOG_RECORD_WORDS);
+
+        // Estado coherente para LOG_find() desde una interrupcion
+        gie = __get_SR_register() & GIE;
+        __disable_interrupt();
+        logSequence = sequence;
+        logHead += chunk;
+        if(logHead == LOG_RECORDS)
+            logHead = 0;
+        logCount += chunk;
+        if(logCount > LOG_RECORDS)
+            logCount = LOG_RECORDS;
+        __bis_SR_register(gie);
+
+        count -= chunk;
+    }
+}
+//*****************************************************************************
+void LOG_append(const uint16_t* data, uint16_t count)
+{
+    LOG_write((const uint8_t*)data, count * LOG_BYTES, LOG_MEASURE, LOG_BYTES);
+}
+//*****************************************************************************
+void LOG_appendBlock(const uint8_t* block, const uint8_t length)
+{
+    LOG_write(block, length, LOG_BLOCK, length);
+}
+//*****************************************************************************
+uint16_t LOG_count(void)
+{
+    return(logCount);
+}
+//*****************************************************************************
+uint16_t LOG_firstSequence(void)
+{
+    uint16_t gie = __get_SR_register() & GIE;
+    uint16_t first;
+
+    __disable_interrupt();
+    first = logSequence - logCount;
+    __bis_SR_register(gie);
+
+    return(first);
+}
+//*****************************************************************************
+const LOG_record* LOG_find(const uint16_t sequence)
+{
+    uint16_t gie = __get_SR_register() & GIE;
+    const LOG_record* record;
+    uint16_t count;
+    uint16_t index;
+    uint16_t slot;
+
+    __disable_interrupt();
+    count = logCount;
+    index = sequence - (uint16_t)(logSequence - count);
+    slot = logHead + (LOG_RECORDS - count) + index;
+    __bis_SR_register(gie);
+
+    if(index >= count)
+        return(0);
+    if(slot >= LOG_RECORDS)
+        slot -= LOG_RECORDS;
+
+    record = &logArea[slot];
+    if(!LOG_isValid(record) || record->sequence != sequence)
+        return(0);
+
+    return(record);
+}
+//*****************************************************************************
+const LOG_record* LOG_read(const uint16_t index)
+{
+    uint16_t slot;
+
+    if(index >= logCount)
+        return(0);
+
+    slot = logHead + (LOG_RECORDS - logCount) + index;
+    if(slot >= LOG_RECORDS)
+        slot -= LOG_RECORDS;
+
+    if(!LOG_isValid(&logArea[slot]) || LOG_crc(&logArea[slot]) != logArea[slot].crc)
+        return(0);
+
+    return(&logArea[slot]);
+}
+//*****************************************************************************
+uint8_t LOG_readBlock(const uint16_t index, uint8_t* buffer, const uint8_t size)
+{
+    const LOG_record* record = LOG_read(index);
+    uint8_t length;
+    uint8_t copied;
+    uint8_t part;
+    uint8_t b;
+
+    if(record == 0 || record->type != LOG_BLOCK || record->length > size)
+        return(0);
+    length = record->length;
+
+    for(copied = 0, part = 0; copied < length; part++)
+    {
+        if(part)
+        {
+            record = LOG_read(index + part);
+            if(record == 0 || record->type != LOG_BLOCK_NEXT || record->length != length)
+                return(0);
+        }
+        for(b = 0; b < LOG_BYTES && copied < length; b++)
+            buffer[copied++] = ((const uint8_t*)record->data)[b];
+    }
+
+    return(length);
+}
@@ -0,0 +1,269 @@
+/**
+  * @file     log.h
+  * @brief    Registro circular de mediciones en FRAM tolerante a cortes de
+  *           alimentacin.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// log.h - Registros de tamao fijo en la regin LOG de la FRAM, escritos con
+//         FRAMCtl_write16(), confirmados con una marca de commit y protegidos
+//         con el CRC-16 del mdulo CRC.
+//
+//*****************************************************************************
+
+#ifndef LOG_H_
+#define LOG_H_
+
+//*****************************************************************************
+//                              Include
+//*****************************************************************************
+#include "driverlib.h"
+
+//*****************************************************************************
+//                              Definiciones
+//*****************************************************************************
+//*****************************************************************************
+//! @name Regin de FRAM:
+//! \brief Deben coincidir con la regin \b LOG de lnk_msp430fr4133.cmd, que
+//!        se reserva al final de la FRAM de programa.
+//! @{
+//*****************************************************************************
+#define LOG_BASE 0xF780
+#define LOG_SIZE 0x0800
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! \details Palabras de datos de cada registro.
+//*****************************************************************************
+#define LOG_WORDS 4
+
+//*****************************************************************************
+//! \details Bytes de datos de cada registro.
+//*****************************************************************************
+#define LOG_BYTES (2 * LOG_WORDS)
+
+//*****************************************************************************
+//! \details Palabras de un registro: secuencia, tipo y largo, datos, CRC y
+//!          marca de commit.
+//*****************************************************************************
+#define LOG_RECORD_WORDS (LOG_WORDS + 4)
+
+//*****************************************************************************
+//! \details Semilla del CRC-16 de cada registro.
+//*****************************************************************************
+#define LOG_CRC_SEED 0xFFFF
+
+//*****************************************************************************
+//! \details Cantidad de registros que entran en la regin.
+//*****************************************************************************
+#define LOG_RECORDS (LOG_SIZE / (2 * LOG_RECORD_WORDS))
+
+//*****************************************************************************
+//! \details Registros que LOG_append() arma en RAM y escribe con una nica
+//!          llamada a FRAMCtl_write16(), es decir, con un nico cambio de la
+//!          proteccin de escritura.
+//*****************************************************************************
+#define LOG_BLOCK_RECORDS 8
+
+//*****************************************************************************
+//! @name Tipos de registro:
+//! \brief Un bloque comprimido (CODEC_finish()) ocupa un registro
+//!        \b LOG_BLOCK seguido de los \b LOG_BLOCK_NEXT necesarios, con
+//!        secuencias consecutivas.
+//! @{
+//*****************************************************************************
+#define LOG_MEASURE    0x01                 // LOG_WORDS palabras de una medicin
+#define LOG_BLOCK      0x02                 // Primeros LOG_BYTES de un bloque
+#define LOG_BLOCK_NEXT 0x03                 // Siguientes LOG_BYTES del bloque
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+//*****************************************************************************
+//! \brief Registro tal como se guarda en FRAM.
+//!
+//! \details La secuencia se escribe primero y la marca de commit al final, en
+//!          la misma pasada. Un registro es vlido solo si
+//!          \b commit == ~\b sequence, por lo que un corte durante la
+//!          escritura deja invlido nicamente el registro en curso: su
+//!          secuencia nueva no coincide con la marca anterior. La FRAM borrada
+//!          (todo 0 o todo 1) tampoco es vlida. El CRC cubre la secuencia,
+//!          el tipo, el largo y los datos y detecta los registros completos
+//!          que se daaron despus, por ejemplo en una cada de tensin.
+//*****************************************************************************
+typedef struct LOG_record
+{
+    //! Nmero de registro, se incrementa en cada uno.
+    uint16_t sequence;
+    //! \b LOG_MEASURE, \b LOG_BLOCK o \b LOG_BLOCK_NEXT.
+    uint8_t type;
+    //! Bytes de la medicin o del bloque completo.
+    uint8_t length;
+    //! Datos; el ltimo registro de un bloque se completa con 0.
+    uint16_t data[LOG_WORDS];
+    //! CRC-16 de \b sequence, \b type, \b length y \b data.
+    uint16_t crc;
+    //! Marca de commit, ~\b sequence.
+    uint16_t commit;
+} LOG_record;
+
+//*****************************************************************************
+//                              Funciones Prototipos
+//*****************************************************************************
+//*****************************************************************************
+//! \brief Indica si un registro de la FRAM est completo.
+//!
+//! \param record Registro a verificar.
+//!
+//! \return \c 1 si la marca de commit coincide con la secuencia.
+//*****************************************************************************
+static inline uint8_t LOG_isValid(const LOG_record* record);
+
+//*****************************************************************************
+//! \brief Calcula con el mdulo CRC el CRC-16 de un registro.
+//!
+//! \param record Registro en FRAM o en RAM.
+//!
+//! \return \c CRC-16 de la secuencia, el tipo, el largo y los datos.
+//*****************************************************************************
+static uint16_t LOG_crc(const LOG_record* record);
+
+//*****************************************************************************
+//! \brief Escribe registros de un mismo tipo al final del registro circular.
+//!
+//! \details \b Descripcin \n
+//!          Reparte \p bytes en registros de \b LOG_BYTES; si \p type es
+//!          \b LOG_BLOCK los registros siguientes al primero son
+//!          \b LOG_BLOCK_NEXT.
+//!
+//! \param data Datos.
+//! \param bytes Bytes de \p data.
+//! \param type Tipo del primer registro.
+//! \param length Valor del campo \b length de cada registro.
+//!
+//! \return \c void
+//*****************************************************************************
+static void LOG_write(const uint8_t* data, uint16_t bytes, const uint8_t type,
+                      const uint8_t length);
+
+//*****************************************************************************
+//! \brief Recupera el estado del registro circular luego de un reset.
+//!
+//! \details \b Descripcin \n
+//!          Recorre la regin y toma como ltimo registro el vlido de mayor
+//!          secuencia (comparando con aritmtica mdulo 2^16). La cantidad de
+//!          registros guardados se obtiene retrocediendo desde ah mientras
+//!          las secuencias sean consecutivas. No guarda nada en RAM que deba
+//!          sobrevivir al corte.
+//!
+//! \return \c void
+//*****************************************************************************
+void LOG_init(void);
+
+//*****************************************************************************
+//! \brief Agrega registros al final del registro circular.
+//!
+//! \details \b Descripcin \n
+//!          Arma hasta \b LOG_BLOCK_RECORDS registros \b LOG_MEASURE en RAM
+//!          con su secuencia, su CRC y su marca y los escribe con una sola
+//!          llamada a FRAMCtl_write16(). El CRC se calcula con el mdulo CRC.
+//!          Si el bloque cruza el final de la regin se escribe en dos partes.
+//!          Al estar lleno se pisan los registros ms antiguos.
+//!
+//! \param data Datos de los registros, \b LOG_WORDS palabras por registro.
+//! \param count Cantidad de registros en \p data.
+//!
+//! \return \c void
+//!
+//! \attention Modifica el registro \b SYSCFG0 durante la escritura y usa el
+//!            mdulo CRC.
+//*****************************************************************************
+void LOG_append(const uint16_t* data, uint16_t count);
+
+//*****************************************************************************
+//! \brief Agrega un bloque comprimido al final del registro circular.
+//!
+//! \details \b Descripcin \n
+//!          Ocupa <tt>(length + LOG_BYTES - 1) / LOG_BYTES</tt> registros,
+//!          cuatro para un bloque de \b CODEC_BLOCK_SIZE bytes contra 64
+//!          muestras. Se escribe como LOG_append(): si un corte deja el bloque
+//!          a medias, LOG_readBlock() no lo devuelve.
+//!
+//! \param block Bloque, por ejemplo el cerrado con CODEC_finish().
+//! \param length Bytes de \p block; 0 no escribe nada.
+//!
+//! \return \c void
+//!
+//! \attention Modifica el registro \b SYSCFG0 durante la escritura y usa el
+//!            mdulo CRC.
+//*****************************************************************************
+void LOG_appendBlock(const uint8_t* block, const uint8_t length);
+
+//*****************************************************************************
+//! \brief Cantidad de registros guardados.
+//!
+//! \return \c Registros vlidos, hasta \b LOG_RECORDS.
+//*****************************************************************************
+uint16_t LOG_count(void);
+
+//*****************************************************************************
+//! \brief Secuencia del registro ms antiguo.
+//!
+//! \details \b Descripcin \n
+//!          Junto con LOG_count() da el rango de secuencias guardadas. Se
+//!          puede llamar desde una interrupcin: LOG_append() actualiza el
+//!          estado con las interrupciones deshabilitadas.
+//!
+//! \return \c Secuencia del registro ms antiguo.
+//*****************************************************************************
+uint16_t LOG_firstSequence(void);
+
+//*****************************************************************************
+//! \brief Busca un registro por su secuencia sin copiarlo ni verificar el CRC.
+//!
+//! \details \b Descripcin \n
+//!          Pensada para leer la FRAM directamente desde una interrupcin; el
+//!          CRC queda para quien recibe el registro.
+//!
+//! \param sequence Secuencia buscada.
+//!
+//! \return \c Puntero al registro en FRAM o \c 0 si no est guardado o su
+//!         marca de commit no es vlida.
+//*****************************************************************************
+const LOG_record* LOG_find(const uint16_t sequence);
+
+//*****************************************************************************
+//! \brief Lee un registro guardado.
+//!
+//! \param index Posicin desde el ms antiguo (0) hasta LOG_count() - 1.
+//!
+//! \return \c Puntero al registro en FRAM o \c 0 si \p index no existe, el
+//!         registro no es vlido o su CRC no coincide.
+//!
+//! \attention Usa el mdulo CRC.
+//*****************************************************************************
+const LOG_record* LOG_read(const uint16_t index);
+
+//*****************************************************************************
+//! \brief Lee un bloque comprimido guardado.
+//!
+//! \param index Posicin del registro \b LOG_BLOCK, como en LOG_read().
+//! \param buffer Donde se copia el bloque, para pasarlo a CODEC_decode().
+//! \param size Tamao de \p buffer.
+//!
+//! \return \c Bytes del bloque o \c 0 si \p index no es el comienzo de un
+//!         bloque, no entra en \p buffer o alguno de sus registros falta o no
+//!         pasa el CRC.
+//!
+//! \attention Usa el mdulo CRC.
+//*****************************************************************************
+uint8_t LOG_readBlock(const uint16_t index, uint8_t* buffer, const uint8_t size);
+
+#endif /* LOG_H_ */
@@ -1,13 +1,28 @@
-#include "adccc.h"
+#include "sensors.h"
+#include "log.h"
+#include "export.h"
+
+// Sensores: bateria, EC5 y MPX5700. Para agregar un sensor basta con agregar una entrada.
+static const SENSOR_descriptor sensors[] =
+{
+    // adcPin,    vcc,              data              settle                  conversion
+    { { ADCINCH_4, GPIO_PIN(4, 7),   GPIO_PIN(1, 4) },  SENSOR_SETTLE_ADAPTIVE, SENSOR_battery },     // 8.2 k y 2.2k son los valores del divisor resistivo y 0.9v es la caida en los transistores.
+    { { ADCINCH_9, GPIO_PIN(4, 0),   GPIO_PIN(8, 1) },  SENSOR_SETTLE_ADAPTIVE, SENSOR_voltage },     // Con este valor se calcula la humedad. No se calcula aqui porque es necesario calibrar el sensor en base al suelo donde se coloca.
+    { { ADCINCH_5, GPIO_PIN(5, 6),   GPIO_PIN(1, 5) },  SENSOR_SETTLE_ADAPTIVE, SENSOR_mpx5700 },     // Este es un sensor de 5v, por lo tanto se coloca un divisor resistivo para llevarlo a 3.3v y no daar el MCU.
+};
+
+#define SENSORS_COUNT (sizeof(sensors) / sizeof(sensors[0]))
 
 int main(void)
 {
     // Variables locales
-    volatile uint16_t adcResult = 0;                            // Guarda la conversion de los sensores en crudo.
-    volatile float vSup = 0.0;
-    volatile float vBat = 0.0;
-    volatile float ec5 = 0.0;
-    volatile float mpx5700 = 0.0;
+    uint16_t adcResults[SENSORS_COUNT];                         // Conversiones en crudo de los sensores.
+    int16_t values[SENSORS_COUNT];                              // Valores convertidos de los sensores.
+    volatile uint16_t vSup = 0;                                 // Tension de alimentacion en mV.
+    volatile uint16_t vBat = 0;                                 // Tension de la bateria en mV.
+    volatile uint16_t ec5 = 0;                                  // Tension del EC5 en mV.
+    volatile int16_t mpx5700 = 0;                               // Presion del MPX5700 en kPa.
+    uint16_t record[LOG_WORDS];                                 // Registro de la medicion en FRAM.
 
     // WATCHDOG -----------------------------------------------------------------------------------------------------------------------------------------------
     WDT_A_hold(WDT_A_BASE);
@@ -15,33 +30,41 @@ int main(void)
     // Desabilita el modo de alta impedancia habilitando la configuracin establecida previamente.
     PM5CTL0 &= ~LOCKLPM5;
 
-    // VREF -----------------------------------------------------------------------------------------------------------------------------------------------
-    // VREF - Obtengo el valor de referencia de 1.5.
-    adcResult = ADC_getVref();
+    // REGISTRO -------------------------------------------------------------------------------------------------------------------------------------------
+    // REGISTRO - Recupera la posicion del registro circular en FRAM.
+    LOG_init();
 
-    // VREF - Calculo de la tension de alimentacin
-    vSup = (1.5 * 1023) / adcResult;
+    // SALIDA -------------------------------------------------------------------------------------------------------------------------------------------
+    // SALIDA - UART por P1.0; las tramas se envian por interrupcion sin esperar a la linea.
+    EXPORT_init(EXPORT_BAUD);
 
-    // BATERIA --------------------------------------------------------------------------------------------------------------------------------------------
-    // BATERIA - Obtengo la conversion de la bateria.
-    adcResult = ADC_takeMeasure(ADCINCH_4, 4, 7, 1, 4);
+    // SENSORES -------------------------------------------------------------------------------------------------------------------------------------------
+    // SENSORES - Obtiene la tension de alimentacion y mide todos los sensores de la tabla.
+    vSup = SENSOR_measureAll(sensors, SENSORS_COUNT, adcResults, values);
 
-    // BATERIA - Calculo del voltaje de la bateria.
-    vBat = (((adcResult * vSup) / 1023) * ((8200 + 2200) / 2200)) + 0.9;  // 8.2 k y 2.2k son los valores del divisor resistivo y 0.9v es la caida en los transistores.
+    // SENSORES - Si la conversion de la bateria cambio demasiado se vuelve a medir la referencia.
+    ADC_checkVrefDrift(adcResults[0]);
 
-    // EC5 -------------------------------------------------------------------------------------------------------------------------------------------
-    // EC5 - Realiza una medicion
-    adcResult = ADC_takeMeasure(ADCINCH_9, 4, 0, 8, 1);
+    vBat = values[0];
+    ec5 = values[1];
+    mpx5700 = values[2];
 
-    // EC5 - Calculo de la tension del sensor.
-    ec5 = (adcResult * vSup) / 1023;    // Con este valor se calcula la humedad. No se calcula aqui porque es necesario calibrar el sensor en base al suelo donde se coloca.
+    // REGISTRO - Guarda la medicion; un corte durante la escritura solo pierde este registro.
+    record[0] = vSup;
+    record[1] = vBat;
+    record[2] = ec5;
+    record[3] = (uint16_t)mpx5700;
+    LOG_append(record, 1);
 
-    // MPX5700 -------------------------------------------------------------------------------------------------------------------------------------------
-    // MPX5700 - Realiza una medicin
-    adcResult = ADC_takeMeasure(ADCINCH_5, 5, 6, 1, 5);
+    // SALIDA - Envia la medicion en una trama binaria.
+    EXPORT_send(EXPORT_MEASURE, (const uint8_t*)record, sizeof(record));
 
-    mpx5700 = ((adcResult - 41.37) / (972.28 - 41.37)) * 700; // Este es un sensor de 5v, por lo tanto se coloca un divisor resistivo para llevarlo a 3.3v y no daar el MCU.
-                                                              // De ahi salen los valores de offset para obtener un valor correcto en la medicion.
+    // SALIDA - En modo configuracion vuelca todo el registro de la FRAM mientras la CPU duerme.
+    GPIO_configurationMode;
+    if(GPIO_configurationPin)
+        EXPORT_dump(LOG_firstSequence());
 
-    while(1);
+    // Sin nada mas que hacer la CPU queda en LPM3, o en LPM0 hasta terminar de transmitir.
+    while(1)
+        EXPORT_sleep();
 }
@@ -0,0 +1,127 @@
+/*
+ * ringbuf.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Matas Lpez - Jess Lpez
+ */
+//*****************************************************************************
+//
+// ringbuf.c - Buffer circular de un productor y un consumidor.
+//
+//*****************************************************************************
+
+#include "driverlib.h"
+#include "ringbuf.h"
+
+// Barrera del compilador; con data volatile el orden ya est garantizado
+#if defined(__GNUC__)
+#define RINGBUF_barrier() __asm__ __volatile__("" ::: "memory")
+#else
+#define RINGBUF_barrier()
+#endif
+
+//*****************************************************************************
+void RINGBUF_init(RINGBUF_buffer* ring, volatile uint16_t* data, const uint16_t size)
+{
+    ring->data = data;
+    ring->mask = size - 1;
+    ring->head = 0;
+    ring->tail = 0;
+    ring->overruns = 0;
+}
+//*****************************************************************************
+uint8_t RINGBUF_put(RINGBUF_buffer* ring, const uint16_t value)
+{
+    uint16_t head = ring->head;
+
+    uint16_t gie;
+
+    if((uint16_t)(head - ring->tail) > ring->mask)
+    {
+        // Full, drop the sample. The consumer may be the ISR
+        gie = __get_SR_register() & GIE;
+        __disable_interrupt();
+        ring->overruns++;
+        __bis_SR_register(gie);
+        return(STATUS_FAIL);
+    }
+
+    ring->data[head & ring->mask] = value;
+    RINGBUF_barrier();
+    ring->head = head + 1;                  // Publish after the data write
+
+    return(STATUS_SUCCESS);
+}
+//*****************************************************************************
+uint8_t RINGBUF_get(RINGBUF_buffer* ring, uint16_t* value)
+{
+    uint16_t tail = ring->tail;
+
+    if(tail == ring->head)
+        return(STATUS_FAIL);                // Empty
+
+    *value = ring->data[tail & ring->mask];
+    RINGBUF_barrier();
+    ring->tail = tail + 1;                  // Release after the data read
+
+    return(STATUS_SUCCESS);
+}
+//*****************************************************************************
+uint16_t RINGBUF_count(const RINGBUF_buffer* ring)
+{
+    return((uint16_t)(ring->head - ring->tail));
+}
+//*****************************************************************************
+uint16_t RINGBUF_takeOverruns(RINGBUF_buffer* ring)
+{
+    uint16_t gie = __get_SR_register() & GIE;
+    uint16_t overruns;
+
+    __disable_interrupt();
+    overruns = ring->overruns;
+    ring->overruns = 0;
+    __bis_SR_register(gie);
+
+    return(overruns);
+}
+//*****************************************************************************
+void RINGBUF_initBytes(RINGBUF_bytes* ring, volatile uint8_t* data, const uint16_t size)
+{
+    ring->data = data;
+    ring->mask = size - 1;
+    ring->head = 0;
+    ring->tail = 0;
+}
+//*****************************************************************************
+uint8_t RINGBUF_putByte(RINGBUF_bytes* ring, const uint8_t value)
+{
+    uint16_t head = ring->head;
+
+    if((uint16_t)(head - ring->tail) > ring->mask)
+        return(STATUS_FAIL);                // Full
+
+    ring->data[head & ring->mask] = value;
+    RINGBUF_barrier();
+    ring->head = head + 1;                  // Publish after the data write
+
+    return(STATUS_SUCCESS);
+}
+//*****************************************************************************
+uint8_t RINGBUF_getByte(RINGBUF_bytes* ring, uint8_t* value)
+{
+    uint16_t tail = ring->tail;
+
+    if(tail == ring->head)
+        return(STATUS_FAIL);                // Empty
+
+    *value = ring->data[tail & ring->mask];
+    RINGBUF_barrier();
+    ring->tail = tail + 1;                  // Release after the data read
+
+    return(STATUS_SUCCESS);
+}
+//*****************************************************************************
+uint16_t RINGBUF_countBytes(const RINGBUF_bytes* ring)
+{
+    return((uint16_t)(ring->head - ring->tail));
+}
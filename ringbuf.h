@@ -0,0 +1,173 @@
+/**
+  * @file     ringbuf.h
+  * @brief    Buffer circular de muestras entre una interrupcin y el programa
+  *           principal.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// ringbuf.h - Buffer circular de un productor y un consumidor.
+//
+//*****************************************************************************
+
+#ifndef RINGBUF_H_
+#define RINGBUF_H_
+
+//*****************************************************************************
+//                              Include
+//*****************************************************************************
+#include <stdint.h>
+
+//*****************************************************************************
+//                              Definiciones
+//*****************************************************************************
+//*****************************************************************************
+//! \brief Buffer circular de un nico productor y un nico consumidor.
+//!
+//! \details Los ndices \b head y \b tail avanzan libremente y se enmascaran
+//!          con \b mask al acceder a \b data, por lo que el tamao debe ser
+//!          potencia de 2. \b head solo lo escribe el productor (por ejemplo
+//!          \b ADC_ISR) y \b tail solo el consumidor (el programa principal).
+//!          Como la escritura de 16 bits es atmica en el MSP430 no es
+//!          necesario deshabilitar las interrupciones. \b data es volatile
+//!          para que el compilador no mueva el acceso a la muestra despus
+//!          de publicar \b head o \b tail.
+//*****************************************************************************
+typedef struct RINGBUF_buffer
+{
+    //! Arreglo donde se guardan las muestras.
+    volatile uint16_t* data;
+    //! Tamao del arreglo menos uno.
+    uint16_t mask;
+    //! Prxima posicin a escribir, la modifica solo el productor.
+    volatile uint16_t head;
+    //! Prxima posicin a leer, la modifica solo el consumidor.
+    volatile uint16_t tail;
+    //! Muestras descartadas por encontrarse el buffer lleno.
+    volatile uint16_t overruns;
+} RINGBUF_buffer;
+
+//*****************************************************************************
+//! \brief Buffer circular de bytes, para colas de transmisin.
+//!
+//! \details Igual a \b RINGBUF_buffer con elementos de 8 bits, de modo que
+//!          cada byte ocupa un byte de RAM. No cuenta descartes: el productor
+//!          comprueba el lugar con RINGBUF_countBytes() antes de encolar.
+//*****************************************************************************
+typedef struct RINGBUF_bytes
+{
+    //! Arreglo donde se guardan los bytes.
+    volatile uint8_t* data;
+    //! Tamao del arreglo menos uno.
+    uint16_t mask;
+    //! Prxima posicin a escribir, la modifica solo el productor.
+    volatile uint16_t head;
+    //! Prxima posicin a leer, la modifica solo el consumidor.
+    volatile uint16_t tail;
+} RINGBUF_bytes;
+
+//*****************************************************************************
+//                              Funciones Prototipos
+//*****************************************************************************
+//*****************************************************************************
+//! \brief Inicializa un buffer circular.
+//!
+//! \param ring Buffer a inicializar.
+//! \param data Arreglo donde se guardan las muestras.
+//! \param size Cantidad de elementos de \p data, debe ser potencia de 2.
+//!
+//! \return \c void
+//*****************************************************************************
+void RINGBUF_init(RINGBUF_buffer* ring, volatile uint16_t* data, const uint16_t size);
+
+//*****************************************************************************
+//! \brief Agrega una muestra al buffer. Solo debe llamarla el productor.
+//!
+//! \details \b Descripcin \n
+//!          Escribe la muestra y luego avanza \b head, de modo que el
+//!          consumidor nunca lee una posicin incompleta. Si el buffer est
+//!          lleno la muestra se descarta y se incrementa \b overruns.
+//!
+//! \param ring Buffer donde se agrega la muestra.
+//! \param value Muestra a agregar.
+//!
+//! \return \c STATUS_SUCCESS si se agreg o \c STATUS_FAIL si estaba lleno.
+//*****************************************************************************
+uint8_t RINGBUF_put(RINGBUF_buffer* ring, const uint16_t value);
+
+//*****************************************************************************
+//! \brief Extrae una muestra del buffer. Solo debe llamarla el consumidor.
+//!
+//! \param ring Buffer de donde se extrae la muestra.
+//! \param value Puntero donde se guarda la muestra extrada.
+//!
+//! \return \c STATUS_SUCCESS si se extrajo o \c STATUS_FAIL si estaba vaco.
+//*****************************************************************************
+uint8_t RINGBUF_get(RINGBUF_buffer* ring, uint16_t* value);
+
+//*****************************************************************************
+//! \brief Cantidad de muestras disponibles para leer.
+//!
+//! \param ring Buffer a consultar.
+//!
+//! \return \c La cantidad de muestras en el buffer.
+//*****************************************************************************
+uint16_t RINGBUF_count(const RINGBUF_buffer* ring);
+
+//*****************************************************************************
+//! \brief Obtiene y reinicia el contador de muestras descartadas.
+//!
+//! \details \b Descripcin \n
+//!          Lee y reinicia \b overruns con las interrupciones deshabilitadas,
+//!          de modo que un descarte ocurrido durante la lectura no se pierde
+//!          sin importar de qu lado est la interrupcin.
+//!
+//! \param ring Buffer a consultar.
+//!
+//! \return \c La cantidad de muestras descartadas desde la ltima consulta.
+//*****************************************************************************
+uint16_t RINGBUF_takeOverruns(RINGBUF_buffer* ring);
+
+//*****************************************************************************
+//! \brief Inicializa un buffer circular de bytes.
+//!
+//! \param ring Buffer a inicializar.
+//! \param data Arreglo donde se guardan los bytes.
+//! \param size Cantidad de bytes de \p data, debe ser potencia de 2.
+//!
+//! \return \c void
+//*****************************************************************************
+void RINGBUF_initBytes(RINGBUF_bytes* ring, volatile uint8_t* data, const uint16_t size);
+
+//*****************************************************************************
+//! \brief Agrega un byte al buffer. Solo debe llamarla el productor.
+//!
+//! \param ring Buffer donde se agrega el byte.
+//! \param value Byte a agregar.
+//!
+//! \return \c STATUS_SUCCESS si se agreg o \c STATUS_FAIL si estaba lleno.
+//*****************************************************************************
+uint8_t RINGBUF_putByte(RINGBUF_bytes* ring, const uint8_t value);
+
+//*****************************************************************************
+//! \brief Extrae un byte del buffer. Solo debe llamarla el consumidor.
+//!
+//! \param ring Buffer de donde se extrae el byte.
+//! \param value Puntero donde se guarda el byte extrado.
+//!
+//! \return \c STATUS_SUCCESS si se extrajo o \c STATUS_FAIL si estaba vaco.
+//*****************************************************************************
+uint8_t RINGBUF_getByte(RINGBUF_bytes* ring, uint8_t* value);
+
+//*****************************************************************************
+//! \brief Cantidad de bytes disponibles para leer.
+//!
+//! \param ring Buffer a consultar.
+//!
+//! \return \c La cantidad de bytes en el buffer.
+//*****************************************************************************
+uint16_t RINGBUF_countBytes(const RINGBUF_bytes* ring);
+
+#endif /* RINGBUF_H_ */
@@ -0,0 +1,117 @@
+/*
+ * sensors.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Matas Lpez - Jess Lpez
+ */
+//*****************************************************************************
+//
+// sensors.c - Motor de medicin de sensores definido por tabla.
+//
+//*****************************************************************************
+
+#include "sensors.h"
+//*****************************************************************************
+uint16_t SENSOR_measureAll(const SENSOR_descriptor* table, const uint8_t count,
+                           uint16_t* raw, int16_t* values)
+{
+    GPIO_group power;
+    uint8_t order[SENSOR_MAX];
+    uint32_t settleUs[SENSOR_MAX];
+    uint16_t scan[16];
+    uint16_t supplyMv;
+    uint32_t elapsed = 0;
+    uint32_t settle;
+    uint16_t channelMask;
+    uint16_t below;
+    uint8_t index;
+    uint8_t first;
+    uint8_t last;
+    uint8_t i;
+    uint8_t j;
+
+    // order y settleUs tienen lugar para SENSOR_MAX sensores
+    if(count > SENSOR_MAX)
+        return(0);
+
+    // Tension de alimentacion
+    supplyMv = CONV_supplyMillivolts(ADC_getVrefCached());
+
+    // Tiempo de estabilizacion en us; los adaptativos sin aprender se aprenden ahora
+    for(i = 0; i < count; i++)
+    {
+        if(table[i].settleMs != SENSOR_SETTLE_ADAPTIVE)
+            settleUs[i] = table[i].settleMs * 1000UL;
+        else
+        {
+            if(!ADC_isSettleLearned(table[i].adc.adcPin))
+                ADC_learnSettle(&table[i].adc);
+            settleUs[i] = ADC_getSettleUs(table[i].adc.adcPin);
+        }
+    }
+
+    // Ordena por tiempo de estabilizacion y alimenta todos los sensores
+    GPIO_clearGroup(&power);
+    for(i = 0; i < count; i++)
+    {
+        for(j = i; j > 0 && settleUs[order[j - 1]] > settleUs[i]; j--)
+            order[j] = order[j - 1];
+        order[j] = i;
+
+        GPIO_addToGroup(&power, &table[i].adc.vcc);
+    }
+    GPIO_powerOnGroup(&power);
+
+    // Una secuencia de conversion por cada tiempo de estabilizacion
+    for(first = 0; first < count; first = last)
+    {
+        settle = settleUs[order[first]];
+        channelMask = 0;
+        for(last = first; last < count && settleUs[order[last]] == settle; last++)
+            channelMask |= 0x0001 << table[order[last]].adc.adcPin;
+
+        if(settle - elapsed > 0xFFFF)
+            delay_ms((uint16_t)((settle - elapsed + 999) / 1000));
+        else if(settle > elapsed)
+            delay_us((uint16_t)(settle - elapsed));
+        elapsed = settle;
+
+        ADC_scanChannels(channelMask, scan);
+
+        // Apaga el grupo y ordena los resultados
+        GPIO_clearGroup(&power);
+        for(j = first; j < last; j++)
+        {
+            i = order[j];
+            GPIO_addToGroup(&power, &table[i].adc.vcc);
+            GPIO_addToGroup(&power, &table[i].adc.data);
+
+            index = 0;
+            for(below = channelMask & ((0x0001 << table[i].adc.adcPin) - 1); below; below &= below - 1)
+                index++;
+            raw[i] = scan[index];
+        }
+        GPIO_powerOffGroup(&power);
+    }
+
+    // Conversion a unidades de ingenieria
+    for(i = 0; i < count; i++)
+        values[i] = table[i].convert(raw[i], supplyMv);
+
+    return(supplyMv);
+}
+//*****************************************************************************
+int16_t SENSOR_voltage(const uint16_t raw, const uint16_t supplyMv)
+{
+    return((int16_t)CONV_sensorMillivolts(raw, supplyMv));
+}
+//*****************************************************************************
+int16_t SENSOR_battery(const uint16_t raw, const uint16_t supplyMv)
+{
+    return((int16_t)CONV_batteryMillivolts(raw, supplyMv));
+}
+//*****************************************************************************
+int16_t SENSOR_mpx5700(const uint16_t raw, const uint16_t supplyMv)
+{
+    return(CONV_mpx5700Kpa(raw));
+}
@@ -0,0 +1,115 @@
+/**
+  * @file     sensors.h
+  * @brief    Medicin de sensores a partir de una tabla de descriptores.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// sensors.h - Motor de medicin de sensores definido por tabla.
+//
+//*****************************************************************************
+
+#ifndef SENSORS_H_
+#define SENSORS_H_
+
+//*****************************************************************************
+//                              Include
+//*****************************************************************************
+#include "adccc.h"
+#include "convert.h"
+
+//*****************************************************************************
+//                              Definiciones
+//*****************************************************************************
+//*****************************************************************************
+//! \details Cantidad mxima de sensores en una tabla.
+//*****************************************************************************
+#define SENSOR_MAX 10
+
+//*****************************************************************************
+//! \details Valor de \b settleMs para estabilizacin adaptativa: el sensor
+//!          espera el tiempo aprendido con ADC_learnSettle().
+//*****************************************************************************
+#define SENSOR_SETTLE_ADAPTIVE 0xFFFF
+
+//*****************************************************************************
+//! \brief Funcin que convierte la medicin en crudo de un sensor a unidades
+//!        de ingeniera.
+//*****************************************************************************
+typedef int16_t (*SENSOR_convert)(const uint16_t raw, const uint16_t supplyMv);
+
+//*****************************************************************************
+//! \brief Descriptor de un sensor.
+//!
+//! \details Contiene todo lo necesario para medir un sensor, de modo que
+//!          agregar un sensor consiste nicamente en agregar una entrada a la
+//!          tabla. Las tablas se declaran \c const para que queden en FRAM.
+//*****************************************************************************
+typedef struct SENSOR_descriptor
+{
+    //! Entrada analgica y pines de alimentacin y datos.
+    ADC_sensor adc;
+    //! Tiempo de estabilizacin luego de alimentar el sensor en ms, o
+    //! \b SENSOR_SETTLE_ADAPTIVE.
+    uint16_t settleMs;
+    //! Conversin a unidades de ingeniera.
+    SENSOR_convert convert;
+} SENSOR_descriptor;
+
+//*****************************************************************************
+//                              Funciones Prototipos
+//*****************************************************************************
+//*****************************************************************************
+//! \brief Funcin que mide todos los sensores de una tabla.
+//!
+//! \details \b Descripcin \n
+//!          Trata el ciclo de medicin completo como una unidad: obtiene la
+//!          tensin de alimentacin con ADC_getVrefCached(), alimenta todos
+//!          los sensores juntos y los ordena por tiempo de estabilizacin.
+//!          Los sensores con \b SENSOR_SETTLE_ADAPTIVE utilizan
+//!          ADC_getSettleUs(); si todava no tienen un tiempo aprendido se
+//!          aprende antes con ADC_learnSettle(), uno por vez.
+//!          Los sensores que comparten el mismo tiempo se convierten en una
+//!          nica secuencia con ADC_scanChannels() y se apagan apenas
+//!          termina su conversin, por lo que el ADC se configura una vez
+//!          por grupo y no por sensor. Por ltimo aplica la conversin de
+//!          cada descriptor.
+//!
+//! \param table Tabla de descriptores.
+//! \param count Cantidad de sensores en \p table (hasta \b SENSOR_MAX).
+//! \param raw Arreglo donde se guarda la conversin en crudo de cada sensor,
+//!            en el mismo orden que \p table.
+//! \param values Arreglo donde se guarda el valor convertido de cada sensor.
+//!
+//! \return \c La tensin de alimentacin en milivoltios, o 0 sin medir nada
+//!         si \p count supera \b SENSOR_MAX.
+//*****************************************************************************
+uint16_t SENSOR_measureAll(const SENSOR_descriptor* table, const uint8_t count,
+                           uint16_t* raw, int16_t* values);
+
+//*****************************************************************************
+//! @name Conversiones disponibles para los descriptores:
+//! @{
+//*****************************************************************************
+//*****************************************************************************
+//! \brief Tensin en la entrada del ADC en mV, ver CONV_sensorMillivolts().
+//*****************************************************************************
+int16_t SENSOR_voltage(const uint16_t raw, const uint16_t supplyMv);
+
+//*****************************************************************************
+//! \brief Tensin de la batera en mV, ver CONV_batteryMillivolts().
+//*****************************************************************************
+int16_t SENSOR_battery(const uint16_t raw, const uint16_t supplyMv);
+
+//*****************************************************************************
+//! \brief Presin del MPX5700 en kPa, ver CONV_mpx5700Kpa().
+//*****************************************************************************
+int16_t SENSOR_mpx5700(const uint16_t raw, const uint16_t supplyMv);
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+#endif /* SENSORS_H_ */
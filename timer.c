@@ -0,0 +1,243 @@
+/**
+  * @file     timer.c
+  * @brief    Temporizadores por software sobre el Timer0_A3.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// timer.c - Temporizadores de un disparo y peridicos multiplexados en los
+//           canales CCR0, CCR1 y CCR2 del Timer0_A3.
+//
+//*****************************************************************************
+
+#include "timer.h"
+
+//*****************************************************************************
+//                              Variables
+//*****************************************************************************
+static TIMER_handle*     timerQueue;        // Ordenada por vencimiento
+static volatile uint16_t timerOverflows;    // Parte alta de TIMER_now()
+
+//*****************************************************************************
+static uint32_t TIMER_now(void)
+{
+    uint16_t low;
+    uint16_t high = timerOverflows;
+
+    do
+        low = TA0R;
+    while(low != TA0R);
+
+    // Desborde todava no atendido
+    if((TA0CTL & TAIFG) && low < 0x8000)
+        high++;
+
+    return(((uint32_t)high << 16) | low);
+}
+//*****************************************************************************
+static void TIMER_run(void)
+{
+    // Primer uso: ACLK, modo continuo
+    if((TA0CTL & MC) != MC_2)
+    {
+        TA0CTL = TACLR;
+        TA0EX0 = TAIDEX_0;
+        TA0CTL = TASSEL_1 + ID_0 + MC_2;
+        timerOverflows = 0;
+    }
+
+    // Sin TAIE no se contaron desbordes; el pendiente se suma antes de TIMER_now()
+    if(!(TA0CTL & TAIE) && (TA0CTL & TAIFG))
+    {
+        TA0CTL &= ~TAIFG;
+        timerOverflows++;
+    }
+}
+//*****************************************************************************
+static void TIMER_insert(TIMER_handle* timer)
+{
+    TIMER_handle** link = &timerQueue;
+
+    while(*link && (int32_t)((*link)->expiry - timer->expiry) <= 0)
+        link = &(*link)->next;
+
+    timer->next = *link;
+    *link = timer;
+    timer->running = 1;
+}
+//*****************************************************************************
+static void TIMER_arm(const uint32_t now)
+{
+    TIMER_handle* timer = timerQueue;
+    uint16_t ccr[3] = {0, 0, 0};
+    uint16_t cctl[3] = {0, 0, 0};
+    uint8_t channel;
+
+    // Solo vencimientos futuros y antes del prximo desborde
+    for(channel = 0; channel < 3 && timer && (int32_t)(timer->expiry - now) > 0
+        && timer->expiry - now < 0x10000; channel++)
+    {
+        ccr[channel] = (uint16_t)timer->expiry;
+        cctl[channel] = CCIE;                       // Clears CCIFG
+        timer = timer->next;
+    }
+
+    TA0CCR0 = ccr[0];
+    TA0CCTL0 = cctl[0];
+    TA0CCR1 = ccr[1];
+    TA0CCTL1 = cctl[1];
+    TA0CCR2 = ccr[2];
+    TA0CCTL2 = cctl[2];
+
+    if(timerQueue)
+    {
+        TA0CTL |= TAIE;
+        // Vencido o demasiado cerca para el CCR0: lo atiende la interrupcin
+        if((int32_t)(timerQueue->expiry - TIMER_now()) <= TIMER_MARGIN)
+            TA0CCTL0 = CCIE + CCIFG;
+    }
+    else
+        TA0CTL &= ~TAIE;
+}
+//*****************************************************************************
+static uint8_t TIMER_service(void)
+{
+    TIMER_handle* timer;
+    uint8_t wake = TIMER_SLEEP;
+    uint32_t now = TIMER_now();
+
+    while((timer = timerQueue) && (int32_t)(timer->expiry - now) <= TIMER_MARGIN)
+    {
+        // Nunca antes del vencimiento: a lo sumo TIMER_MARGIN cuentas en activo
+        while((int32_t)(timer->expiry - now) > 0)
+            now = TIMER_now();
+
+        timerQueue = timer->next;
+        timer->running = 0;
+        if(timer->period)
+        {
+            timer->expiry += timer->period;
+            TIMER_insert(timer);
+        }
+
+        if(timer->callback == 0 || timer->callback(timer) == TIMER_WAKE)
+            wake = TIMER_WAKE;
+
+        now = TIMER_now();
+    }
+
+    TIMER_arm(now);
+
+    return(wake);
+}
+//*****************************************************************************
+void TIMER_start(TIMER_handle* timer, uint32_t ticks, const uint32_t period,
+                 TIMER_callback callback)
+{
+    uint16_t gie = __get_SR_register() & GIE;
+    uint32_t now;
+
+    __disable_interrupt();
+
+    TIMER_run();
+
+    TIMER_stop(timer);
+
+    if(ticks <= TIMER_MARGIN)
+        ticks = TIMER_MARGIN + 1;
+
+    now = TIMER_now();
+    timer->expiry = now + ticks;
+    timer->period = period;
+    timer->callback = callback;
+    TIMER_insert(timer);
+    TIMER_arm(now);
+
+    __bis_SR_register(gie);
+}
+//*****************************************************************************
+void TIMER_stop(TIMER_handle* timer)
+{
+    uint16_t gie = __get_SR_register() & GIE;
+    TIMER_handle** link = &timerQueue;
+
+    __disable_interrupt();
+
+    if(timer->running)
+    {
+        while(*link && *link != timer)
+            link = &(*link)->next;
+        if(*link)
+            *link = timer->next;
+        timer->running = 0;
+        TIMER_arm(TIMER_now());
+    }
+
+    __bis_SR_register(gie);
+}
+//*****************************************************************************
+uint32_t TIMER_getTime(void)
+{
+    uint16_t gie = __get_SR_register() & GIE;
+    uint32_t now;
+
+    __disable_interrupt();
+    TIMER_run();
+    now = TIMER_now();
+    __bis_SR_register(gie);
+
+    return(now);
+}
+//*****************************************************************************
+void TIMER_wait(TIMER_handle* timer)
+{
+    uint16_t gie = __get_SR_register() & GIE;
+
+    __disable_interrupt();
+    while(timer->running)
+    {
+        __bis_SR_register(LPM3_bits + GIE);
+        __disable_interrupt();
+    }
+
+    __bis_SR_register(gie);
+}
+//***************************************************************************************************************
+// Timer A0 interrupt service routine --> CCR0
+#if defined(__TI_COMPILER_VERSION__) || defined(__IAR_SYSTEMS_ICC__)
+#pragma vector = TIMER0_A0_VECTOR
+__interrupt void TIMER0_A0_ISR(void)
+#elif defined(__GNUC__)
+void __attribute__ ((interrupt(TIMER0_A0_VECTOR))) Timer_A (void)
+#else
+#error Compiler not supported!
+#endif
+{
+    if(TIMER_service() == TIMER_WAKE)
+        __bic_SR_register_on_exit(LPM3_bits);       // Wake main loop, keep GIE
+}
+//***************************************************************************************************************
+// Timer A0 interrupt service routine --> CCR1, CCR2 y TAIFG
+#if defined(__TI_COMPILER_VERSION__) || defined(__IAR_SYSTEMS_ICC__)
+#pragma vector = TIMER0_A1_VECTOR
+__interrupt void TIMER0_A1_ISR(void)
+#elif defined(__GNUC__)
+void __attribute__ ((interrupt(TIMER0_A1_VECTOR))) Timer_A1 (void)
+#else
+#error Compiler not supported!
+#endif
+{
+    switch(__even_in_range(TA0IV, TA0IV_TAIFG))
+    {
+        case TA0IV_TAIFG:
+            timerOverflows++;
+            break;
+        default:                                    // CCR1 y CCR2
+            break;
+    }
+
+    if(TIMER_service() == TIMER_WAKE)
+        __bic_SR_register_on_exit(LPM3_bits);       // Wake main loop, keep GIE
+}
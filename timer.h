@@ -0,0 +1,230 @@
+/**
+  * @file     timer.h
+  * @brief    Temporizadores por software sobre el Timer0_A3.
+  * @date     Created on: 17 oct. 2026
+  * @authors  Matas Lpez - Jess Lpez
+  * @version  1.0
+  */
+//*****************************************************************************
+//
+// timer.h - Temporizadores de un disparo y peridicos multiplexados en los
+//           canales CCR0, CCR1 y CCR2 del Timer0_A3.
+//
+//*****************************************************************************
+
+#ifndef TIMER_H_
+#define TIMER_H_
+
+//*****************************************************************************
+//                              Include
+//*****************************************************************************
+#include "driverlib.h"
+
+//*****************************************************************************
+//                              Definiciones
+//*****************************************************************************
+//*****************************************************************************
+//! \details Frecuencia de las cuentas del servicio. El <b>Timer0_A3</b> cuenta
+//!          \b ACLK sin dividir, que sigue activo en \b LPM3. Solo la usan
+//!          TIMER_MS() y TIMER_US(); delay.h obtiene \b ACLK de \b CS.
+//*****************************************************************************
+#ifndef TIMER_HZ
+#define TIMER_HZ 32768UL
+#endif
+
+//*****************************************************************************
+//! \details Cuentas mnimas hasta el vencimiento. Un vencimiento ms cercano
+//!          podra quedar atrs antes de cargarse en el \b CCRx, por eso
+//!          la interrupcin del \b CCR0 se fuerza y espera en activo hasta
+//!          el vencimiento exacto, nunca antes.
+//*****************************************************************************
+#define TIMER_MARGIN 2
+
+//*****************************************************************************
+//! \details Convierte milisegundos a cuentas, redondeando hacia arriba para
+//!          que la espera nunca sea menor a la pedida. Con una constante se
+//!          resuelve en compilacin.
+//*****************************************************************************
+#define TIMER_MS(ms) ((uint32_t)(((uint32_t)(ms) * TIMER_HZ + 999UL) / 1000UL))
+
+//*****************************************************************************
+//! \details Convierte microsegundos a cuentas, redondeando hacia arriba.
+//*****************************************************************************
+#define TIMER_US(us) ((uint32_t)(((uint32_t)(us) * TIMER_HZ + 999999UL) / 1000000UL))
+
+//*****************************************************************************
+//! @name Valores devueltos por TIMER_callback:
+//! @{
+//*****************************************************************************
+//*****************************************************************************
+//! \details La CPU sigue en bajo consumo al salir de la interrupcin.
+//*****************************************************************************
+#define TIMER_SLEEP 0
+
+//*****************************************************************************
+//! \details La CPU sale de bajo consumo al salir de la interrupcin.
+//*****************************************************************************
+#define TIMER_WAKE 1
+
+//*****************************************************************************
+//! @}
+//*****************************************************************************
+
+typedef struct TIMER_handle TIMER_handle;
+
+//*****************************************************************************
+//! \brief Funcin que se llama desde la interrupcin del timer al vencer un
+//!        temporizador. Devuelve \b TIMER_WAKE o \b TIMER_SLEEP.
+//*****************************************************************************
+typedef uint8_t (*TIMER_callback)(TIMER_handle* timer);
+
+//*****************************************************************************
+//! \brief Temporizador por software.
+//!
+//! \details Lo reserva quien lo utiliza (por ejemplo en la pila de delay_ms())
+//!          y debe permanecer vlido mientras est en la cola. La cola est
+//!          ordenada por vencimiento, por lo que los tres primeros son los
+//!          que ocupan los canales \b CCR0, \b CCR1 y \b CCR2.
+//*****************************************************************************
+struct TIMER_handle
+{
+    //! Siguiente temporizador de la cola.
+    TIMER_handle* next;
+    //! Vencimiento absoluto en cuentas.
+    uint32_t expiry;
+    //! Perodo en cuentas, 0 para un solo disparo.
+    uint32_t period;
+    //! Se llama al vencer, \c 0 equivale a devolver \b TIMER_WAKE.
+    TIMER_callback callback;
+    //! Distinto de 0 mientras est en la cola.
+    volatile uint8_t running;
+};
+
+//*****************************************************************************
+//                              Funciones Prototipos
+//*****************************************************************************
+//*****************************************************************************
+//! \brief Tiempo actual del servicio en cuentas de 32 bits.
+//!
+//! \details \b Descripcin \n
+//!          Extiende el \b TA0R con las desbordes contados en la interrupcin
+//!          \b TAIFG. Lee el \b TA0R hasta obtener dos lecturas iguales, ya
+//!          que \b ACLK es asincrnico a \b MCLK. Debe llamarse con las
+//!          interrupciones deshabilitadas.
+//!
+//! \return \c Cuentas desde que se inici el timer.
+//*****************************************************************************
+static uint32_t TIMER_now(void);
+
+//*****************************************************************************
+//! \brief Pone en marcha el <b>Timer0_A3</b> si est detenido.
+//!
+//! \details \b Descripcin \n
+//!          La primera vez deja el timer en modo continuo con \b ACLK. Con la
+//!          cola vaca \b TAIE est deshabilitado, por lo que un desborde
+//!          pendiente se suma aqu antes de leer el tiempo. Debe llamarse con
+//!          las interrupciones deshabilitadas.
+//!
+//! \return \c void
+//*****************************************************************************
+static void TIMER_run(void);
+
+//*****************************************************************************
+//! \brief Inserta un temporizador en la cola ordenada por vencimiento.
+//!
+//! \param timer Temporizador con \b expiry cargado.
+//!
+//! \return \c void
+//*****************************************************************************
+static void TIMER_insert(TIMER_handle* timer);
+
+//*****************************************************************************
+//! \brief Carga los tres primeros vencimientos en \b CCR0, \b CCR1 y \b CCR2.
+//!
+//! \details \b Descripcin \n
+//!          Solo se cargan los vencimientos que ocurren antes del prximo
+//!          desborde del \b TA0R; los ms lejanos se cargan desde la
+//!          interrupcin \b TAIFG, que queda habilitada mientras la cola no
+//!          est vaca. Si el primero ya venci o vence en menos de
+//!          \b TIMER_MARGIN cuentas se fuerza \b CCIFG con \b CCIE en el
+//!          \b CCR0, incluso si venci con las interrupciones deshabilitadas.
+//!
+//! \param now Tiempo actual, TIMER_now().
+//!
+//! \return \c void
+//*****************************************************************************
+static void TIMER_arm(const uint32_t now);
+
+//*****************************************************************************
+//! \brief Atiende los temporizadores vencidos y vuelve a cargar los canales.
+//!
+//! \details \b Descripcin \n
+//!          Saca de la cola los temporizadores vencidos, reinserta los
+//!          peridicos y llama a sus funciones. Un vencimiento a menos de
+//!          \b TIMER_MARGIN cuentas se espera en activo, por lo que ninguna
+//!          espera es menor a la pedida. Se llama desde las dos
+//!          interrupciones del <b>Timer0_A3</b>.
+//!
+//! \return \c TIMER_WAKE si alguno pidi salir de bajo consumo.
+//*****************************************************************************
+static uint8_t TIMER_service(void);
+
+//*****************************************************************************
+//! \brief Inicia un temporizador.
+//!
+//! \details \b Descripcin \n
+//!          Pone en marcha el timer con TIMER_run(). Si el temporizador ya
+//!          estaba en la cola se reprograma.
+//!          Los temporizadores peridicos vencen en \p ticks y luego cada
+//!          \p period cuentas, sin acumular el retardo de la interrupcin.
+//!
+//! \param timer Temporizador a iniciar.
+//! \param ticks Cuentas hasta el primer vencimiento, TIMER_MS() o TIMER_US().
+//! \param period Cuentas entre vencimientos, 0 para un solo disparo.
+//! \param callback Funcin que se llama al vencer o \c 0.
+//!
+//! \return \c void
+//!
+//! \attention Utiliza el <b>Timer0_A3</b> y sus tres canales.
+//*****************************************************************************
+void TIMER_start(TIMER_handle* timer, uint32_t ticks, const uint32_t period,
+                 TIMER_callback callback);
+
+//*****************************************************************************
+//! \brief Detiene un temporizador y lo saca de la cola.
+//!
+//! \param timer Temporizador a detener.
+//!
+//! \return \c void
+//*****************************************************************************
+void TIMER_stop(TIMER_handle* timer);
+
+//*****************************************************************************
+//! \brief Tiempo actual del servicio.
+//!
+//! \details \b Descripcin \n
+//!          Pone en marcha el timer si hace falta y devuelve TIMER_now(). La
+//!          diferencia entre dos lecturas es vlida aunque la cola est vaca
+//!          mientras no pase ms de un desborde (2 s) sin temporizadores.
+//!
+//! \return \c Cuentas de \b ACLK.
+//*****************************************************************************
+uint32_t TIMER_getTime(void);
+
+//*****************************************************************************
+//! \brief Espera en \b LPM3 hasta que el temporizador vence.
+//!
+//! \details \b Descripcin \n
+//!          Comprueba \b running con las interrupciones deshabilitadas y
+//!          entra en \b LPM3 habilitndolas en la misma instruccin, as un
+//!          vencimiento no puede perderse entre la comprobacin y el bajo
+//!          consumo. Al retornar \b GIE queda como estaba. Los dems
+//!          temporizadores siguen atendindose mientras tanto.
+//!
+//! \param timer Temporizador iniciado con TIMER_start().
+//!
+//! \return \c void
+//*****************************************************************************
+void TIMER_wait(TIMER_handle* timer);
+
+#endif /* TIMER_H_ */